@@ -21,7 +21,7 @@
 ChessBoard::ChessBoard() {
     fenString = string(STARTPOS);
     memset(&structureEval, 0, sizeof(_Tboard));
-    if ((chessboard[SIDETOMOVE_IDX] = loadFen(fenString)) == 2) {
+    if (loadFen(fenString) == FEN_ERROR) {
         fatal("Bad FEN position format ", fenString);
         std::exit(1);
     }
@@ -43,6 +43,15 @@ int ChessBoard::getPieceAt(int side, u64 bitmapPos) {
 
 #endif
 
+void ChessBoard::initIncremental() {
+    memset(mailbox, SQUARE_FREE, sizeof(mailbox));
+    for (int u = 0; u < 12; u++) {
+        for (u64 c = chessboard[u]; c; RESET_LSB(c)) {
+            mailbox[BITScanForward(c)] = u;
+        }
+    }
+}
+
 void ChessBoard::makeZobristKey() {
     chessboard[ZOBRISTKEY_IDX] = 0;
 
@@ -107,67 +116,66 @@ void ChessBoard::display() const {
 }
 
 string ChessBoard::boardToFen() const {
-    string fen;
+    char fen[FEN_MAX_LENGTH];
+    return string(fen, boardToFen(fen));
+}
+
+int ChessBoard::boardToFen(char *fen) const {
+    char *p = fen;
     for (int y = 0; y < 8; y++) {
-        int l = 0;
-        string row;
+        int empty = 0;
         for (int x = 0; x < 8; x++) {
-            int q = getPieceAt<BLACK>(POW2[63 - ((y * 8) + x)]);
-            if (q == SQUARE_FREE) {
-                q = getPieceAt<WHITE>(POW2[63 - ((y * 8) + x)]);
+            const int piece = mailbox[63 - ((y * 8) + x)];
+            if (piece == SQUARE_FREE) {
+                empty++;
+                continue;
             }
-            if (q == SQUARE_FREE) {
-                l++;
-            } else {
-                if (l > 0) {
-                    row.append(1, (char) (l + 48));
-                }
-                l = 0;
-                row.append(1, FEN_PIECE[q]);
+            if (empty) {
+                *p++ = (char) ('0' + empty);
+                empty = 0;
             }
+            *p++ = FEN_PIECE[piece];
         }
-        if (l > 0) {
-            row.append(1, (char) (l + 48));
+        if (empty) {
+            *p++ = (char) ('0' + empty);
         }
-        fen.append(row.c_str());
         if (y < 7) {
-            fen.append("/");
+            *p++ = '/';
         }
     }
-    if (chessboard[SIDETOMOVE_IDX] == BLACK) {
-        fen.append(" b ");
-    } else {
-        fen.append(" w ");
-    }
-    int cst = 0;
-    if (chessboard[RIGHT_CASTLE_IDX] & RIGHT_KING_CASTLE_WHITE_MASK) {
-        fen.append("K");
-        cst++;
-    }
-    if (chessboard[RIGHT_CASTLE_IDX] & RIGHT_QUEEN_CASTLE_WHITE_MASK) {
-        fen.append("Q");
-        cst++;
-    }
-    if (chessboard[RIGHT_CASTLE_IDX] & RIGHT_KING_CASTLE_BLACK_MASK) {
-        fen.append("k");
-        cst++;
-    }
-    if (chessboard[RIGHT_CASTLE_IDX] & RIGHT_QUEEN_CASTLE_BLACK_MASK) {
-        fen.append("q");
-        cst++;
-    }
-    if (!cst) {
-        fen.append("-");
+    *p++ = ' ';
+    *p++ = chessboard[SIDETOMOVE_IDX] == BLACK ? 'b' : 'w';
+    *p++ = ' ';
+    const char *castle = p;
+    if (chessboard[RIGHT_CASTLE_IDX] & RIGHT_KING_CASTLE_WHITE_MASK) *p++ = 'K';
+    if (chessboard[RIGHT_CASTLE_IDX] & RIGHT_QUEEN_CASTLE_WHITE_MASK) *p++ = 'Q';
+    if (chessboard[RIGHT_CASTLE_IDX] & RIGHT_KING_CASTLE_BLACK_MASK) *p++ = 'k';
+    if (chessboard[RIGHT_CASTLE_IDX] & RIGHT_QUEEN_CASTLE_BLACK_MASK) *p++ = 'q';
+    if (p == castle) {
+        *p++ = '-';
     }
+    *p++ = ' ';
     if (chessboard[ENPASSANT_IDX] == NO_ENPASSANT) {
-        fen.append(" -");
+        *p++ = '-';
     } else {
-        fen.append(" ");
-        chessboard[SIDETOMOVE_IDX] ? fen.append(BOARD[chessboard[ENPASSANT_IDX] + 8]) : fen.append(
-            BOARD[chessboard[ENPASSANT_IDX] - 8]);
+        // the square behind the pawn that has just been pushed
+        const int square = chessboard[SIDETOMOVE_IDX] ? chessboard[ENPASSANT_IDX] + 8 : chessboard[ENPASSANT_IDX] - 8;
+        *p++ = (char) ('h' - (square & 7));
+        *p++ = (char) ('1' + (square >> 3));
+    }
+    // halfmove clock, at most 5 digits as parseFen reads it, the fullmove number is not tracked
+    ASSERT_RANGE(fiftyMoveCount, 0, 99999);
+    *p++ = ' ';
+    char digits[5];
+    int n = 0;
+    for (int v = fiftyMoveCount; n == 0 || v; v /= 10) {
+        digits[n++] = (char) ('0' + v % 10);
+    }
+    while (n) {
+        *p++ = digits[--n];
     }
-    fen.append(" 0 1");
-    return fen;
+    memcpy(p, " 1", 3);
+    return (int) (p + 2 - fen);
 }
 
 char ChessBoard::decodeBoard(string a) {
@@ -185,93 +193,131 @@ int ChessBoard::loadFen() {
     return loadFen(fenString);
 }
 
-int ChessBoard::loadFen(string fen) {
+int ChessBoard::loadFen(const string &fen) {
     if (fen.empty()) {
         return loadFen();
     }
-    memset(chessboard, 0, sizeof(_Tchessboard));
-    istringstream iss(fen);
-    string pos, castle, enpassant, side;
-    iss >> pos;
-    iss >> side;
-    iss >> castle;
-    iss >> enpassant;
+    return loadFen(fen.data(), fen.data() + fen.size());
+}
+
+int ChessBoard::loadFen(const char *fen, const char *end) {
+    _Tchessboard board;
+    int fifty;
+    if (parseFen(fen, end, board, fifty) == FEN_ERROR) {
+        return FEN_ERROR;
+    }
+    memcpy(chessboard, board, sizeof(_Tchessboard));
+    fiftyMoveCount = fifty;
+    initIncremental();
+    return chessboard[SIDETOMOVE_IDX];
+}
+
+static inline bool isBlank(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static inline const char *skipBlank(const char *p, const char *end) {
+    while (p < end && isBlank(*p)) p++;
+    return p;
+}
+
+int ChessBoard::parseFen(const char *p, const char *end, _Tchessboard &board, int &fiftyMoveCount) {
+    memset(board, 0, sizeof(_Tchessboard));
+    fiftyMoveCount = 0;
+    p = skipBlank(p, end);
+
+    // piece placement from a8 to h1
     int ix = 0;
-    array<int, 64> s;
-    for (unsigned ii = 0; ii < pos.length(); ii++) {
-        uchar ch = pos.at(ii);
-        if (ch != '/') {
-            if (INV_FEN[ch] != 0xFF) {
-                s[ix++] = INV_FEN[ch];
-            } else if (ch > 47 && ch < 58) {
-                for (int t = 0; t < ch - 48; t++) {
-                    s[ix++] = SQUARE_FREE;
-                }
-            } else {
-                return 2;
-            };
+    for (; p < end && !isBlank(*p); p++) {
+        const uchar ch = *p;
+        if (ch == '/') {
+            continue;
+        }
+        if (ch >= '1' && ch <= '8') {
+            ix += ch - '0';
+        } else if (ch < INV_FEN.size() && INV_FEN[ch] != 0xFF && ix < 64) {
+            const int piece = INV_FEN[ch];
+            const int position = 63 - ix++;
+            board[piece] |= POW2[position];
+            board[MATERIAL_IDX] += MATERIAL_KEY[piece];
+            board[ZOBRISTKEY_IDX] ^= _random::RANDOM_KEY[piece][position];
+        } else {
+            return FEN_ERROR;
+        }
+        if (ix > 64) {
+            return FEN_ERROR;
         }
     }
     if (ix != 64) {
-        return 2;
+        return FEN_ERROR;
     }
-    if (side == "b") {
-        chessboard[SIDETOMOVE_IDX] = BLACK;
-    } else if (side == "w") {
-        chessboard[SIDETOMOVE_IDX] = WHITE;
+
+    // side to move
+    p = skipBlank(p, end);
+    if (p >= end || (p + 1 < end && !isBlank(p[1]))) {
+        return FEN_ERROR;
+    }
+    if (*p == 'b') {
+        board[SIDETOMOVE_IDX] = BLACK;
+    } else if (*p == 'w') {
+        board[SIDETOMOVE_IDX] = WHITE;
     } else {
-        return 2;
+        return FEN_ERROR;
     }
+    p = skipBlank(p + 1, end);
 
-    for (int i = 0; i < 64; i++) {
-        int p = s[63 - i];
-        if (p != SQUARE_FREE) {
-            updateZobristKey(p, i);
-            chessboard[p] |= POW2[i];
-        } else {
-            chessboard[p] &= NOTPOW2[i];
+    // castling rights
+    if (p < end && *p == '-') {
+        p++;
+    } else {
+        for (; p < end && !isBlank(*p); p++) {
+            switch (*p) {
+                case 'K':
+                    board[RIGHT_CASTLE_IDX] |= RIGHT_KING_CASTLE_WHITE_MASK;
+                    break;
+                case 'k':
+                    board[RIGHT_CASTLE_IDX] |= RIGHT_KING_CASTLE_BLACK_MASK;
+                    break;
+                case 'Q':
+                    board[RIGHT_CASTLE_IDX] |= RIGHT_QUEEN_CASTLE_WHITE_MASK;
+                    break;
+                case 'q':
+                    board[RIGHT_CASTLE_IDX] |= RIGHT_QUEEN_CASTLE_BLACK_MASK;
+                    break;
+                default:
+                    return FEN_ERROR;
+            };
         }
-    };
+    }
+    for (u64 x = board[RIGHT_CASTLE_IDX]; x; RESET_LSB(x)) {
+        board[ZOBRISTKEY_IDX] ^= _random::RANDOM_KEY[RIGHT_CASTLE_IDX][BITScanForward(x)];
+    }
+    p = skipBlank(p, end);
 
-    for (unsigned e = 0; e < castle.length(); e++) {
-        switch (castle.at(e)) {
-            case 'K':
-                updateZobristKey(RIGHT_CASTLE_IDX, 4);
-                ASSERT(4 == BITScanForward(RIGHT_KING_CASTLE_WHITE_MASK));
-                chessboard[RIGHT_CASTLE_IDX] |= RIGHT_KING_CASTLE_WHITE_MASK;
-                break;
-            case 'k':
-                updateZobristKey(RIGHT_CASTLE_IDX, 6);
-                ASSERT(6 == BITScanForward(RIGHT_KING_CASTLE_BLACK_MASK));
-                chessboard[RIGHT_CASTLE_IDX] |= RIGHT_KING_CASTLE_BLACK_MASK;
-                break;
-            case 'Q':
-                updateZobristKey(RIGHT_CASTLE_IDX, 5);
-                ASSERT(5 == BITScanForward(RIGHT_QUEEN_CASTLE_WHITE_MASK));
-                chessboard[RIGHT_CASTLE_IDX] |= RIGHT_QUEEN_CASTLE_WHITE_MASK;
-                break;
-            case 'q':
-                updateZobristKey(RIGHT_CASTLE_IDX, 7);
-                ASSERT(7 == BITScanForward(RIGHT_QUEEN_CASTLE_BLACK_MASK));
-                chessboard[RIGHT_CASTLE_IDX] |= RIGHT_QUEEN_CASTLE_BLACK_MASK;
-                break;
-            default:;
-        };
-    };
-    chessboard[ENPASSANT_IDX] = NO_ENPASSANT;
-    for (int i = 0; i < 64; i++) {
-        if (enpassant == BOARD[i]) {
-            chessboard[ENPASSANT_IDX] = i;
-            if (chessboard[SIDETOMOVE_IDX]) {
-                chessboard[ENPASSANT_IDX] -= 8;
-            } else {
-                chessboard[ENPASSANT_IDX] += 8;
-            }
-            updateZobristKey(ENPASSANT_IDX, chessboard[ENPASSANT_IDX]);
-            break;
+    // en passant target square, stored as the square of the pawn that has just been pushed
+    board[ENPASSANT_IDX] = NO_ENPASSANT;
+    if (p < end && *p == '-') {
+        p++;
+    } else {
+        const char rank = board[SIDETOMOVE_IDX] == WHITE ? '6' : '3';
+        if (p + 2 > end || p[0] < 'a' || p[0] > 'h' || p[1] != rank) {
+            return FEN_ERROR;
         }
+        const int square = (rank - '1') * 8 + ('h' - p[0]);
+        board[ENPASSANT_IDX] = board[SIDETOMOVE_IDX] == WHITE ? square - 8 : square + 8;
+        board[ZOBRISTKEY_IDX] ^= _random::RANDOM_KEY[ENPASSANT_IDX][board[ENPASSANT_IDX]];
+        p += 2;
     }
-    return chessboard[SIDETOMOVE_IDX];
+    if (p < end && !isBlank(*p)) {
+        return FEN_ERROR;
+    }
+
+    // optional halfmove clock, an EPD line has its operations here instead
+    p = skipBlank(p, end);
+    for (; p < end && *p >= '0' && *p <= '9' && fiftyMoveCount < 10000; p++) {
+        fiftyMoveCount = fiftyMoveCount * 10 + (*p - '0');
+    }
+    return board[SIDETOMOVE_IDX];
 }
 
 #ifdef DEBUG_MODE
@@ -284,4 +330,25 @@ bool ChessBoard::checkNPieces(std::unordered_map<int, int> pieces) {
     return a == 13;
 }
 
+bool ChessBoard::checkIncremental() const {
+    for (int i = 0; i < 12; i++) {
+        if (i != KING_BLACK && i != KING_WHITE && getPieceCount(i) != bitCount(chessboard[i])) {
+            return false;
+        }
+    }
+    for (int i = 0; i < 64; i++) {
+        int piece = SQUARE_FREE;
+        for (int u = 0; u < 12; u++) {
+            if (chessboard[u] & POW2[i]) {
+                piece = u;
+                break;
+            }
+        }
+        if (mailbox[i] != piece) {
+            return false;
+        }
+    }
+    return true;
+}
+
 #endif
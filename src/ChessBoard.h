@@ -53,6 +53,7 @@ public:
 #define ENPASSANT_IDX 13
 #define SIDETOMOVE_IDX 14
 #define ZOBRISTKEY_IDX 15
+#define MATERIAL_IDX 16
 
     ChessBoard();
 
@@ -90,15 +91,29 @@ public:
     static constexpr uchar KING_SIDE_CASTLE_MOVE_MASK = 0x4;
     static constexpr uchar QUEEN_SIDE_CASTLE_MOVE_MASK = 0x8;
 
+    /// returned by loadFen/parseFen instead of the side to move when the FEN/EPD is malformed
+    static constexpr int FEN_ERROR = 2;
+    /// buffer size for boardToFen(char *), terminator included
+    static constexpr int FEN_MAX_LENGTH = 90;
+
     void display() const;
 
     string boardToFen() const;
 
+    /// writes the null-terminated FEN into fen[FEN_MAX_LENGTH] and returns its length, no allocation
+    int boardToFen(char *fen) const;
+
     string getFen();
 
     char decodeBoard(string);
 
-    int loadFen(string);
+    int loadFen(const string &);
+
+    /// loads a FEN or EPD line (operations after the fields are ignored), the board is left untouched on FEN_ERROR
+    int loadFen(const char *fen, const char *end);
+
+    /// parses [fen, end) into board and fiftyMoveCount without allocating, returns the side to move or FEN_ERROR
+    static int parseFen(const char *fen, const char *end, _Tchessboard &board, int &fiftyMoveCount);
 
     int getPieceByChar(char);
 
@@ -108,6 +123,8 @@ public:
 
     bool checkNPieces(std::unordered_map<int, int>);
 
+    bool checkIncremental() const;
+
 #endif
 
     static u64 colors(int pos) {
@@ -121,6 +138,25 @@ public:
             chessboard[KNIGHT_BLACK + side] | chessboard[KING_BLACK + side] | chessboard[QUEEN_BLACK + side];
     }
 
+    u64 getAllPieces() const {
+        return getBitmap<BLACK>() | getBitmap<WHITE>();
+    }
+
+    /// number of pieces of a type but the king, from the counts in the material key
+    int getPieceCount(const int piece) const {
+        ASSERT(piece != KING_BLACK && piece != KING_WHITE);
+        return (chessboard[MATERIAL_IDX] >> MATERIAL_COUNT_SHIFT[piece]) & 0xf;
+    }
+
+    /// key of the pawn structure, mixed from the two pawn bitboards (splitmix64 finalizer)
+    /// when asked for, so makemove and takeback don't pay for it
+    u64 getPawnKey() const {
+        u64 key = chessboard[PAWN_WHITE] ^ (chessboard[PAWN_BLACK] * 0x9E3779B97F4A7C15ULL);
+        key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+        return key ^ (key >> 31);
+    }
+
     template<int side>
     static u64 getBitmap(const _Tchessboard &chessboard) {
         return chessboard[PAWN_BLACK + side] | chessboard[ROOK_BLACK + side] | chessboard[BISHOP_BLACK + side] |
@@ -143,35 +179,9 @@ public:
 
     template<int side>
     int getPieceAt(const u64 bitmapPos) const {
-        return ((chessboard[PAWN_BLACK + side] & bitmapPos) ? PAWN_BLACK + side : ((chessboard[ROOK_BLACK + side] &
-            bitmapPos) ? ROOK_BLACK + side
-                       : ((chessboard[
-                BISHOP_BLACK +
-                    side] &
-                bitmapPos) ?
-                          BISHOP_BLACK + side
-                           : ((chessboard[
-                    KNIGHT_BLACK +
-                        side] &
-                    bitmapPos)
-                              ?
-                              KNIGHT_BLACK +
-                                  side
-                              : ((chessboard[
-                        QUEEN_BLACK +
-                            side] &
-                        bitmapPos)
-                                 ?
-                                 QUEEN_BLACK +
-                                     side
-                                 : ((chessboard[
-                            KING_BLACK +
-                                side] &
-                            bitmapPos)
-                                    ?
-                                    KING_BLACK +
-                                        side
-                                    : SQUARE_FREE))))));
+        ASSERT(bitCount(bitmapPos) == 1);
+        const int piece = mailbox[BITScanForward(bitmapPos)];
+        return (piece != SQUARE_FREE && (piece & 1) == side) ? piece : SQUARE_FREE;
     }
 
     static string getCell(const int file, const int rank) {
@@ -183,6 +193,12 @@ protected:
 
     _Tchessboard chessboard;
 
+    /// piece on each square or SQUARE_FREE, kept in step with the bitboards by makemove/takeback
+    uchar mailbox[64];
+
+    /// plies since the last capture, pawn move or castle (FEN halfmove clock)
+    int fiftyMoveCount = 0;
+
     typedef struct {
         u64 allPieces;
         u64 kingAttackers[2];
@@ -232,11 +248,17 @@ protected:
 
     void makeZobristKey();
 
+    void initIncremental();
+
+    void movePieceAt(const int from, const int to) {
+        mailbox[to] = mailbox[from];
+        mailbox[from] = SQUARE_FREE;
+    }
+
     template<int side>
     int getNpiecesNoPawnNoKing() const {
-        return bitCount(
-            chessboard[ROOK_BLACK + side] | chessboard[BISHOP_BLACK + side] | chessboard[KNIGHT_BLACK + side] |
-                chessboard[QUEEN_BLACK + side]);
+        return getPieceCount(ROOK_BLACK + side) + getPieceCount(BISHOP_BLACK + side) +
+            getPieceCount(KNIGHT_BLACK + side) + getPieceCount(QUEEN_BLACK + side);
     }
 
     template<int side>
@@ -17,9 +17,13 @@
 */
 
 #include "Eval.h"
+#include "db/bitbase/kpk.h"
 
 using namespace _eval;
-u64 *Eval::evalHash;
+using namespace _bitbase;
+Eval::_Tmaterial Eval::materialTable[MATERIAL_TABLE_SIZE];
+bool Eval::materialGenerated = false;
+mutex Eval::mutexMaterial;
 
 #ifdef BENCH_MODE
 Time Eval::evalTime;
@@ -29,32 +33,256 @@ Time Eval::kingTime;
 Time Eval::rookTime;
 Time Eval::knightTime;
 Time Eval::queenTime;
+u64 Eval::pawnHashProbes;
+u64 Eval::pawnHashHits;
+u64 Eval::evalHashProbes;
+u64 Eval::evalHashHits;
 #endif
 
-Eval::Eval() {
-    if (evalHash == nullptr)
-        evalHash = (u64 *) calloc(hashSize, sizeof(u64));
+Eval::Eval() : evalHash(nullptr), evalHashMask(0), pawnEntry(nullptr) {
+    setEvalHashSize(EVAL_HASH_SIZE_DEFAULT);
+    pawnHash = (_TpawnEntry *) alignedMalloc(PAWN_HASH_SIZE * sizeof(_TpawnEntry));
+    memset(pawnHash, 0, PAWN_HASH_SIZE * sizeof(_TpawnEntry));
+    std::lock_guard<std::mutex> lock(mutexMaterial);
+    if (materialGenerated) {
+        return;
+    }
+    int count[12] = {0};
+    for (int idx = 0; idx < MATERIAL_TABLE_SIZE; idx++) {
+        for (int side = 0, x = idx; side < 2; side++, x /= 486) {
+            count[PAWN_BLACK + side] = x % 9;
+            count[KNIGHT_BLACK + side] = x / 9 % 3;
+            count[BISHOP_BLACK + side] = x / 27 % 3;
+            count[ROOK_BLACK + side] = x / 81 % 3;
+            count[QUEEN_BLACK + side] = x / 243 % 2;
+        }
+        setMaterial(materialTable[idx], count);
+    }
+    materialGenerated = true;
+}
+
+void Eval::setMaterial(_Tmaterial &material, const int count[12]) {
+    int pieces[2], pawns[2];
+    for (int side = 0; side < 2; side++) {
+        material.value[side] = (short) (count[PAWN_BLACK + side] * VALUEPAWN + count[ROOK_BLACK + side] * VALUEROOK +
+            count[BISHOP_BLACK + side] * VALUEBISHOP + count[KNIGHT_BLACK + side] * VALUEKNIGHT +
+            count[QUEEN_BLACK + side] * VALUEQUEEN);
+        pieces[side] = count[ROOK_BLACK + side] + count[BISHOP_BLACK + side] + count[KNIGHT_BLACK + side] +
+            count[QUEEN_BLACK + side];
+        pawns[side] = count[PAWN_BLACK + side];
+    }
+    const int npieces = pieces[BLACK] + pieces[WHITE];
+    material.phase = npieces < 4 ? END : (npieces < 11 ? MIDDLE : OPEN);
+
+    //regexp: KN?B*KB*
+    material.flags = 0;
+    const int minors[2] = {count[BISHOP_BLACK] + count[KNIGHT_BLACK], count[BISHOP_WHITE] + count[KNIGHT_WHITE]};
+    if (!pawns[BLACK] && !pawns[WHITE] && pieces[BLACK] == minors[BLACK] && pieces[WHITE] == minors[WHITE]) {
+        //KK KBK KNK KBKB KNKN KBKN KNNK
+        if (npieces < 2 || (minors[BLACK] == 1 && minors[WHITE] == 1) ||
+            (npieces == 2 && (count[KNIGHT_BLACK] == 2 || count[KNIGHT_WHITE] == 2))) {
+            material.flags |= MATERIAL_DRAW;
+        }
+    }
+
+    material.endgame = NO_ENDGAME;
+    material.strongSide = WHITE;
+    for (int side = 0; side < 2; side++) {
+        const int xside = side ^ 1;
+        if (pieces[xside] || pawns[xside]) {
+            continue;
+        }
+        if (!pieces[side] && pawns[side] == 1) {
+            material.endgame = KPK;
+        } else if (!pawns[side] && pieces[side] == 2 && count[BISHOP_BLACK + side] == 1 &&
+            count[KNIGHT_BLACK + side] == 1) {
+            material.endgame = KBNK;
+        } else if (!pawns[side] && pieces[side] == 1 && (count[ROOK_BLACK + side] || count[QUEEN_BLACK + side])) {
+            material.endgame = KXK;
+        } else {
+            continue;
+        }
+        material.strongSide = (uchar) side;
+    }
+    if (pieces[BLACK] == 1 && pieces[WHITE] == 1 && count[BISHOP_BLACK] == 1 && count[BISHOP_WHITE] == 1 &&
+        (pawns[BLACK] || pawns[WHITE])) {
+        material.endgame = OPPOSITE_BISHOPS;
+    }
+}
+
+u64 Eval::getMaterialKey() const {
+    u64 key = 0;
+    for (int i = 0; i < 12; i++) {
+        key += MATERIAL_KEY[i] * bitCount(chessboard[i]);
+    }
+    return key;
+}
+
+bool Eval::isKpkDraw(const int strongSide, const int side) const {
+    const int kw = BITScanForward(chessboard[KING_WHITE]);
+    const int kb = BITScanForward(chessboard[KING_BLACK]);
+    return strongSide == WHITE ? isDraw<WHITE>(side, kw, kb, BITScanForward(chessboard[PAWN_WHITE]))
+                               : isDraw<BLACK>(side, kw, kb, BITScanForward(chessboard[PAWN_BLACK]));
+}
+
+/// score of a recognized endgame for side: KPK from the bitbase, the weak king driven to the edge in KXK and to a
+/// corner of the bishop color in KBNK
+int Eval::evaluateEndgame(const _Tmaterial &material, const int side) {
+    const int strongSide = material.strongSide;
+    const int strongKing = BITScanForward(chessboard[KING_BLACK + strongSide]);
+    const int weakKing = BITScanForward(chessboard[KING_BLACK + (strongSide ^ 1)]);
+    int result = material.value[strongSide] + KNOWN_WIN + MOP_UP_KING * (7 - distance(strongKing, weakKing));
+    switch (material.endgame) {
+        case KPK: {
+            if (isKpkDraw(strongSide, side)) {
+                return 0;
+            }
+            const int pawnPos = BITScanForward(chessboard[PAWN_BLACK + strongSide]);
+            result += PAWN_IN_7TH * (strongSide == WHITE ? pawnPos / 8 : 7 - pawnPos / 8);
+            break;
+        }
+        case KBNK: {
+            const u64 corners = colors(BITScanForward(chessboard[BISHOP_BLACK + strongSide])) & CORNERS;
+            const int corner1 = BITScanForward(corners);
+            const int corner2 = BITScanReverse(corners);
+            result += MOP_UP_CORNER * (7 - min(distance(weakKing, corner1), distance(weakKing, corner2)));
+            break;
+        }
+        case KXK:
+            result += MOP_UP_CORNER * centerDistance(weakKing);
+            break;
+        default:
+            _assert(0);
+    }
+    return side == strongSide ? result : -result;
 }
 
 Eval::~Eval() {
-    free(evalHash);
-    evalHash = nullptr;
+    alignedFree(evalHash);
+    alignedFree(pawnHash);
+}
+
+/// kb rounded down to a power of two of buckets, only while the thread is not searching
+void Eval::setEvalHashSize(const int kb) {
+    u64 buckets = 1;
+    while (buckets * 2 * sizeof(_TevalBucket) <= (u64) kb * 1024) {
+        buckets *= 2;
+    }
+    if (evalHash && evalHashMask == buckets - 1) {
+        return;
+    }
+    alignedFree(evalHash);
+    evalHash = (_TevalBucket *) alignedMalloc(buckets * sizeof(_TevalBucket));
+    if (!evalHash) {
+        fatal("info string error - no memory");
+        exit(1);
+    }
+    evalHashMask = buckets - 1;
+    clearEvalHash();
 }
 
 template<int side>
 void Eval::openFile() {
     structureEval.openFile = 0;
     structureEval.semiOpenFile[side] = 0;
+    const u64 pawnFiles = pawnEntry->files[BLACK] | pawnEntry->files[WHITE];
 
     for (u64 side_rooks = chessboard[ROOK_BLACK + side]; side_rooks; RESET_LSB(side_rooks)) {
         const int o = BITScanForward(side_rooks);
-        if (!(FILE_[o] & (chessboard[WHITE] | chessboard[BLACK])))
+        if (!(pawnFiles & POW2[o]))
             structureEval.openFile |= FILE_[o];
-        else if (FILE_[o] & chessboard[side ^ 1])
+        else if (pawnEntry->files[side ^ 1] & POW2[o])
             structureEval.semiOpenFile[side] |= FILE_[o];
     }
 }
 
+/// the pawn entry of the position, the structure is evaluated on a miss
+const Eval::_TpawnEntry &Eval::probePawnHash() {
+    const u64 key = getPawnKey();
+    _TpawnEntry &entry = pawnHash[key & (PAWN_HASH_SIZE - 1)];
+    BENCH(pawnHashProbes++);
+#ifdef DEBUG_MODE
+    // always evaluated, for the trace and to check the entry
+    _TpawnEntry check;
+    memset(&check, 0, sizeof(_TpawnEntry));
+    check.key = key;
+    evaluatePawnStructure<WHITE>(check);
+    evaluatePawnStructure<BLACK>(check);
+    ASSERT(entry.key != key || !memcmp(&check, &entry, sizeof(_TpawnEntry)));
+#endif
+    if (entry.key == key) {
+        BENCH(pawnHashHits++);
+        return entry;
+    }
+#ifdef DEBUG_MODE
+    entry = check;
+#else
+    entry.key = key;
+    evaluatePawnStructure<WHITE>(entry);
+    evaluatePawnStructure<BLACK>(entry);
+#endif
+    return entry;
+}
+
+/**
+ * pawn-only terms of side, cached in the pawn hash
+ * 9. unprotected - no friends pawn protect it
+ * 11. isolated - there aren't friend pawns on the two sides - subtracts PAWN_ISOLATED for each pawn
+ * 12. doubled - there aren't friend pawns on the two sides - subtracts DOUBLED_PAWNS for each pawn. If it is isolated too substracts DOUBLED_ISOLATED_PAWNS
+ * 13. backward - if there isn't friend pawns forward and on sides in 1 rank below subtracts BACKWARD_PAWN
+ * 14. passed - if there isn't friend pawns forward and forward on sides until 8' rank add PAWN_PASSED[side][pos]
+ */
+template<int side>
+void Eval::evaluatePawnStructure(_TpawnEntry &entry) {
+    constexpr int xside = side ^1;
+    const u64 ped_friends = chessboard[side];
+    int result = 0;
+    u64 passed = 0;
+    u64 files = 0;
+    for (u64 p = ped_friends; p; RESET_LSB(p)) {
+        bool isolated = false;
+        const int o = BITScanForward(p);
+        files |= FILE_[o];
+
+        /// unprotected
+        if (!(ped_friends & TABLE(PAWN_PROTECTED_MASK)[side][o])) {
+            result -= UNPROTECTED_PAWNS;
+            ADD(SCORE_DEBUG.UNPROTECTED_PAWNS[side], -UNPROTECTED_PAWNS);
+        }
+        /// isolated
+        if (!(ped_friends & TABLE(PAWN_ISOLATED_MASK)[o])) {
+            result -= PAWN_ISOLATED;
+            ADD(SCORE_DEBUG.PAWN_ISOLATED[side], -PAWN_ISOLATED);
+            isolated = true;
+        }
+        /// doubled
+        if (NOTPOW2[o] & FILE_[o] & ped_friends) {
+            result -= DOUBLED_PAWNS;
+            ADD(SCORE_DEBUG.DOUBLED_PAWNS[side], -DOUBLED_PAWNS);
+            /// doubled and isolated
+            if (isolated) {
+                ADD(SCORE_DEBUG.DOUBLED_ISOLATED_PAWNS[side], -DOUBLED_ISOLATED_PAWNS);
+                result -= DOUBLED_ISOLATED_PAWNS;
+            }
+        }
+        /// backward
+        if (!(ped_friends & TABLE(PAWN_BACKWARD_MASK)[side][o])) {
+            ADD(SCORE_DEBUG.BACKWARD_PAWN[side], -BACKWARD_PAWN);
+            result -= BACKWARD_PAWN;
+        }
+        /// passed
+        if (!(chessboard[xside] & TABLE(PAWN_PASSED_MASK)[side][o])) {
+            ADD(SCORE_DEBUG.PAWN_PASSED[side], PAWN_PASSED[side][o]);
+            result += TABLE(PAWN_PASSED)[side][o];
+            passed |= POW2[o];
+        }
+    }
+    entry.score[side] = (short) result;
+    entry.passed[side] = passed;
+    entry.files[side] = files;
+    entry.attacks[side] = shiftForward<side, 7>(ped_friends) | shiftForward<side, 9>(ped_friends);
+}
+
 /**
  * evaluate pawns for color at phase
  * 1. if no pawns returns -NO_PAWNS
@@ -72,7 +300,7 @@ void Eval::openFile() {
 
  */
 template<int side, Eval::_Tphase phase>
-int Eval::evaluatePawn() {
+HOT_KERNEL int Eval::evaluatePawn() {
     INC(evaluationCount[side]);
     int result = 0;
     constexpr int xside = side ^1;
@@ -88,10 +316,10 @@ int Eval::evaluatePawn() {
     // 7.
     if (phase != OPEN) {
         structureEval.kingSecurity[side] +=
-            FRIEND_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side]] & ped_friends);
+            FRIEND_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[side]] & ped_friends);
 
         structureEval.kingSecurity[side] -=
-            ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[xside]] & ped_friends);
+            ENEMY_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[xside]] & ped_friends);
     }
 
     // 8.  pawn in 8th
@@ -108,55 +336,21 @@ int Eval::evaluatePawn() {
 
     }
 
-    for (u64 p = ped_friends; p; RESET_LSB(p)) {
-        bool isolated = false;
-        const int o = BITScanForward(p);
-        u64 pos = POW2[o];
-
-        // 4. attack king
-        if (structureEval.posKingBit[xside] & PAWN_FORK_MASK[side][o]) {
-            structureEval.kingAttackers[xside] |= pos;
-            result += ATTACK_KING;
-        }
-
-        /// blocked
-        result -= (!(PAWN_FORK_MASK[side][o] & structureEval.allPiecesSide[xside])) &&
-            (structureEval.allPieces & (shiftForward<side, 8>(pos))) ? PAWN_BLOCKED : 0;
-        ADD(SCORE_DEBUG.PAWN_BLOCKED[side], (!(PAWN_FORK_MASK[side][o] & structureEval.allPiecesSide[xside])) &&
-            (structureEval.allPieces & (shiftForward<side, 8>(pos))) ? -PAWN_BLOCKED
-                                                                     : 0);
-        /// unprotected
-        if (!(ped_friends & PAWN_PROTECTED_MASK[side][o])) {
-            result -= UNPROTECTED_PAWNS;
-            ADD(SCORE_DEBUG.UNPROTECTED_PAWNS[side], -UNPROTECTED_PAWNS);
-        }
-        /// isolated
-        if (!(ped_friends & PAWN_ISOLATED_MASK[o])) {
-            result -= PAWN_ISOLATED;
-            ADD(SCORE_DEBUG.PAWN_ISOLATED[side], -PAWN_ISOLATED);
-            isolated = true;
-        }
-        /// doubled
-        if (NOTPOW2[o] & FILE_[o] & ped_friends) {
-            result -= DOUBLED_PAWNS;
-            ADD(SCORE_DEBUG.DOUBLED_PAWNS[side], -DOUBLED_PAWNS);
-            /// doubled and isolated
-            if (isolated) {
-                ADD(SCORE_DEBUG.DOUBLED_ISOLATED_PAWNS[side], -DOUBLED_ISOLATED_PAWNS);
-                result -= DOUBLED_ISOLATED_PAWNS;
-            }
-        }
-        /// backward
-        if (!(ped_friends & PAWN_BACKWARD_MASK[side][o])) {
-            ADD(SCORE_DEBUG.BACKWARD_PAWN[side], -BACKWARD_PAWN);
-            result -= BACKWARD_PAWN;
-        }
-        /// passed
-        if (!(chessboard[xside] & PAWN_PASSED_MASK[side][o])) {
-            ADD(SCORE_DEBUG.PAWN_PASSED[side], PAWN_PASSED[side][o]);
-            result += PAWN_PASSED[side][o];
-        }
-    }
+    // 9. 11. - 14. pawn structure, from the pawn hash
+    result += pawnEntry->score[side];
+
+    // 4. attack king
+    const u64 attackers = ped_friends & (shiftForward<xside, 7>(structureEval.posKingBit[xside]) |
+        shiftForward<xside, 9>(structureEval.posKingBit[xside]));
+    structureEval.kingAttackers[xside] |= attackers;
+    result += ATTACK_KING * bitCount(attackers);
+
+    /// blocked
+    const u64 enemies = structureEval.allPiecesSide[xside];
+    const u64 blocked = ped_friends & shiftForward<xside, 8>(structureEval.allPieces) &
+        ~(shiftForward<xside, 7>(enemies) | shiftForward<xside, 9>(enemies));
+    result -= PAWN_BLOCKED * bitCount(blocked);
+    ADD(SCORE_DEBUG.PAWN_BLOCKED[side], -PAWN_BLOCKED * bitCount(blocked));
     return result;
 }
 
@@ -172,7 +366,7 @@ int Eval::evaluatePawn() {
  * 8. bishop on big diagonal
  */
 template<int side, Eval::_Tphase phase>
-int Eval::evaluateBishop(const u64 enemies) {
+HOT_KERNEL int Eval::evaluateBishop(const u64 enemies) {
     INC(evaluationCount[side]);
     u64 bishop = chessboard[BISHOP_BLACK + side];
 
@@ -196,7 +390,7 @@ int Eval::evaluateBishop(const u64 enemies) {
     // 3. *king security*
     if (phase != OPEN) {
         structureEval.kingSecurity[side] -=
-            ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side ^ 1]] & bishop);
+            ENEMY_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[side ^ 1]] & bishop);
         ADD(SCORE_DEBUG.KING_SECURITY_BISHOP[side],
             -ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side ^ 1]] & bishop));
     }
@@ -236,12 +430,12 @@ int Eval::evaluateBishop(const u64 enemies) {
         }
 
         // 7. outposts
-        auto p = BISHOP_OUTPOST[side][o];
+        auto p = TABLE(BISHOP_OUTPOST)[side][o];
         constexpr int xside = side ^1;
         //enemy pawn doesn't attack bishop
-        if (p && !(PAWN_FORK_MASK[side ^ 1][o] & chessboard[side ^ 1])) {
+        if (p && !(TABLE(PAWN_FORK_MASK)[side ^ 1][o] & chessboard[side ^ 1])) {
             //friend paws defends bishop
-            if (PAWN_FORK_MASK[side ^ 1][o] & chessboard[side]) {
+            if (pawnEntry->attacks[side] & POW2[o]) {
                 result += p;
                 if (!(chessboard[KNIGHT_BLACK + xside]) &&
                     !(chessboard[BISHOP_BLACK + xside] & ChessBoard::colors(o))) {
@@ -262,7 +456,7 @@ int Eval::evaluateBishop(const u64 enemies) {
  * 6. 5. bishop on queen - if there is a bishop on same diagonal add BISHOP_ON_QUEEN
  */
 template<int side, Eval::_Tphase phase>
-int Eval::evaluateQueen(const u64 enemies) {
+HOT_KERNEL int Eval::evaluateQueen(const u64 enemies) {
     INC(evaluationCount[side]);
     u64 queen = chessboard[QUEEN_BLACK + side];
     int result = 0;
@@ -270,12 +464,12 @@ int Eval::evaluateQueen(const u64 enemies) {
     // 2. *king security*
     if (phase != OPEN) {
         structureEval.kingSecurity[side] +=
-            FRIEND_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side]] & queen);
+            FRIEND_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[side]] & queen);
         ADD(SCORE_DEBUG.KING_SECURITY_QUEEN[side],
             FRIEND_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side]] & queen));
 
         structureEval.kingSecurity[side] -=
-            ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side ^ 1]] & queen);
+            ENEMY_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[side ^ 1]] & queen);
         ADD(SCORE_DEBUG.KING_SECURITY_QUEEN[side ^ 1],
             -ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side ^ 1]] & queen));
     }
@@ -290,7 +484,7 @@ int Eval::evaluateQueen(const u64 enemies) {
         if (x & structureEval.posKingBit[side ^ 1])
             structureEval.kingAttackers[side ^ 1] |= POW2[o];
         // 4. half open file
-        if ((chessboard[side ^ 1] & FILE_[o])) {
+        if (pawnEntry->files[side ^ 1] & POW2[o]) {
             ADD(SCORE_DEBUG.HALF_OPEN_FILE_Q[side], HALF_OPEN_FILE_Q);
             result += HALF_OPEN_FILE_Q;
         }
@@ -302,7 +496,7 @@ int Eval::evaluateQueen(const u64 enemies) {
         }
 
         // 6. bishop on queen
-        if (DIAGONAL_ANTIDIAGONAL[o] & chessboard[BISHOP_BLACK + side]) {
+        if (TABLE(DIAGONAL_ANTIDIAGONAL)[o] & chessboard[BISHOP_BLACK + side]) {
             ADD(SCORE_DEBUG.BISHOP_ON_QUEEN[side], BISHOP_ON_QUEEN);
             result += BISHOP_ON_QUEEN;
         }
@@ -320,7 +514,7 @@ int Eval::evaluateQueen(const u64 enemies) {
 */
 
 template<int side, Eval::_Tphase phase>
-int Eval::evaluateKnight(const u64 enemiesPawns, const u64 notMyBits) {
+HOT_KERNEL int Eval::evaluateKnight(const u64 enemiesPawns, const u64 notMyBits) {
     INC(evaluationCount[side]);
     u64 knight = chessboard[KNIGHT_BLACK + side];
     if (!knight) return 0;
@@ -338,12 +532,12 @@ int Eval::evaluateKnight(const u64 enemiesPawns, const u64 notMyBits) {
     // 4. king security
     if (phase != OPEN) {
         structureEval.kingSecurity[side] +=
-            FRIEND_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side]] & knight);
+            FRIEND_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[side]] & knight);
         ADD(SCORE_DEBUG.KING_SECURITY_KNIGHT[side],
             FRIEND_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side]] & knight));
 
         structureEval.kingSecurity[side] -=
-            ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side ^ 1]] & knight);
+            ENEMY_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[side ^ 1]] & knight);
         ADD(SCORE_DEBUG.KING_SECURITY_KNIGHT[side ^ 1],
             -ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side ^ 1]] & knight));
     }
@@ -352,18 +546,18 @@ int Eval::evaluateKnight(const u64 enemiesPawns, const u64 notMyBits) {
 
         // 5. mobility
         ASSERT(bitCount(notMyBits & KNIGHT_MASK[pos]) < (int) (sizeof(MOB_KNIGHT) / sizeof(int)));
-        u64 mob = notMyBits & KNIGHT_MASK[pos];
+        u64 mob = notMyBits & TABLE(KNIGHT_MASK)[pos];
         result += MOB_KNIGHT[bitCount(mob)];
         if (mob & structureEval.posKingBit[side ^ 1]) structureEval.kingAttackers[side ^ 1] |= POW2[pos];
         ADD(SCORE_DEBUG.MOB_KNIGHT[side], MOB_KNIGHT[bitCount(mob)]);
 
         // 6. outposts
-        auto p = KNIGHT_OUTPOST[side][pos];
+        auto p = TABLE(KNIGHT_OUTPOST)[side][pos];
         constexpr int xside = side ^1;
         //enemy pawn doesn't attack knight
-        if (p && !(PAWN_FORK_MASK[side ^ 1][pos] & chessboard[side ^ 1])) {
+        if (p && !(TABLE(PAWN_FORK_MASK)[side ^ 1][pos] & chessboard[side ^ 1])) {
             //friend paws defends knight
-            if (PAWN_FORK_MASK[side ^ 1][pos] & chessboard[side]) {
+            if (pawnEntry->attacks[side] & POW2[pos]) {
                 result += p;
                 if (!(chessboard[KNIGHT_BLACK + xside]) &&
                     !(chessboard[BISHOP_BLACK + xside] & ChessBoard::colors(pos))) {
@@ -387,7 +581,7 @@ int Eval::evaluateKnight(const u64 enemiesPawns, const u64 notMyBits) {
  * 8. Penalise if Rook is Blocked Horizontally
 */
 template<int side, Eval::_Tphase phase>
-int Eval::evaluateRook(const u64 king, const u64 enemies, const u64 friends) {
+HOT_KERNEL int Eval::evaluateRook(const u64 king, const u64 enemies, const u64 friends) {
     INC(evaluationCount[side]);
 
     u64 rook = chessboard[ROOK_BLACK + side];
@@ -406,12 +600,12 @@ int Eval::evaluateRook(const u64 king, const u64 enemies, const u64 friends) {
     // 4. king security
     if (phase != OPEN) {
         structureEval.kingSecurity[side] +=
-            FRIEND_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side]] & rook);
+            FRIEND_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[side]] & rook);
         ADD(SCORE_DEBUG.KING_SECURITY_ROOK[side],
             FRIEND_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[side]] & rook));
 
         structureEval.kingSecurity[side] -=
-            ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[xside]] & rook);
+            ENEMY_NEAR_KING * bitCount(TABLE(NEAR_MASK2)[structureEval.posKing[xside]] & rook);
         ADD(SCORE_DEBUG.KING_SECURITY_ROOK[xside],
             -ENEMY_NEAR_KING * bitCount(NEAR_MASK2[structureEval.posKing[xside]] & rook));
 
@@ -427,7 +621,9 @@ int Eval::evaluateRook(const u64 king, const u64 enemies, const u64 friends) {
     if (nRooks == 2) {
         const int firstRook = BITScanForward(rook);
         const int secondRook = BITScanReverse(rook);
-        if ((!(LINK_ROOKS[firstRook][secondRook] & structureEval.allPieces))) {
+        const u64 between = TABLE(LINK_SQUARE)[firstRook][secondRook];
+        /// same rank or file, not side by side and nothing in between
+        if (between && (TABLE(RANK_FILE)[firstRook] & POW2[secondRook]) && !(between & structureEval.allPieces)) {
             ADD(SCORE_DEBUG.CONNECTED_ROOKS[side], CONNECTED_ROOKS);
             result += CONNECTED_ROOKS;
         }
@@ -445,18 +641,18 @@ int Eval::evaluateRook(const u64 king, const u64 enemies, const u64 friends) {
 
         if (phase != OPEN) {
             // .8 Penalise if Rook is Blocked Horizontally
-            if ((RANK_BOUND[o] & structureEval.allPieces) == RANK_BOUND[o]) {
+            if ((TABLE(RANK_BOUND)[o] & structureEval.allPieces) == RANK_BOUND[o]) {
                 ADD(SCORE_DEBUG.ROOK_BLOCKED[side], -ROOK_BLOCKED);
                 result -= ROOK_BLOCKED;
             }
         }
 
         // .5
-        if (!(chessboard[side] & FILE_[o])) {
+        if (!(pawnEntry->files[side] & POW2[o])) {
             ADD(SCORE_DEBUG.ROOK_OPEN_FILE[side], OPEN_FILE);
             result += OPEN_FILE;
         }
-        if (!(chessboard[side ^ 1] & FILE_[o])) {
+        if (!(pawnEntry->files[side ^ 1] & POW2[o])) {
             ADD(SCORE_DEBUG.ROOK_OPEN_FILE[side], OPEN_FILE);
             result += OPEN_FILE;
         }
@@ -465,21 +661,21 @@ int Eval::evaluateRook(const u64 king, const u64 enemies, const u64 friends) {
 }
 
 template<Eval::_Tphase phase>
-int Eval::evaluateKing(int side, u64 squares) {
+HOT_KERNEL int Eval::evaluateKing(int side, u64 squares) {
     ASSERT(evaluationCount[side] == 5);
     int result = 0;
     uchar pos_king = structureEval.posKing[side];
     if (phase == END) {
         ADD(SCORE_DEBUG.DISTANCE_KING[side], DISTANCE_KING_ENDING[pos_king]);
-        result = DISTANCE_KING_ENDING[pos_king];
+        result = TABLE(DISTANCE_KING_ENDING)[pos_king];
     } else {
         ADD(SCORE_DEBUG.DISTANCE_KING[side], DISTANCE_KING_OPENING[pos_king]);
-        result = DISTANCE_KING_OPENING[pos_king];
+        result = TABLE(DISTANCE_KING_OPENING)[pos_king];
     }
     u64 POW2_king = POW2[pos_king];
     //mobility
     ASSERT(bitCount(squares & NEAR_MASK1[pos_king]) < (int) (sizeof(MOB_KING[phase]) / sizeof(int)));
-    result += MOB_KING[phase][bitCount(squares & NEAR_MASK1[pos_king])];
+    result += MOB_KING[phase][bitCount(squares & TABLE(NEAR_MASK1)[pos_king])];
     ADD(SCORE_DEBUG.MOB_KING[side], MOB_KING[phase][bitCount(squares & NEAR_MASK1[pos_king])]);
     if (phase != OPEN) {
         if ((structureEval.openFile & POW2_king) || (structureEval.semiOpenFile[side ^ 1] & POW2_king)) {
@@ -492,7 +688,7 @@ int Eval::evaluateKing(int side, u64 squares) {
         }
     }
     ASSERT(pos_king < 64);
-    if (!(NEAR_MASK1[pos_king] & chessboard[side])) {
+    if (!(TABLE(NEAR_MASK1)[pos_king] & chessboard[side])) {
         ADD(SCORE_DEBUG.PAWN_NEAR_KING[side], -PAWN_NEAR_KING);
         result -= PAWN_NEAR_KING;
     }
@@ -501,28 +697,47 @@ int Eval::evaluateKing(int side, u64 squares) {
 }
 
 void Eval::storeHashValue(const u64 key, const short value) {
-    evalHash[key % hashSize] = (key & keyMask) | (value & valueMask);
+    u64 *entry = evalHash[key & evalHashMask].entry;
+    // an empty slot or the same key, else a slot picked by key bits the index doesn't use
+    int i = 0;
+    for (; i < EVAL_BUCKET_WAYS; i++) {
+        const u64 kv = entry[i];
+        if (!kv || (kv & keyMask) == (key & keyMask)) break;
+    }
+    if (i == EVAL_BUCKET_WAYS) {
+        i = (key >> 62) & (EVAL_BUCKET_WAYS - 1);
+    }
+    entry[i] = (key & keyMask) | (value & valueMask);
     ASSERT(value == getHashValue(key));
 }
 
 short Eval::getHashValue(const u64 key) const {
-    const u64 kv = evalHash[key % hashSize];
-    if ((kv & keyMask) == (key & keyMask))
-        return (short) (kv & valueMask);
-
+    const u64 *entry = evalHash[key & evalHashMask].entry;
+    BENCH(evalHashProbes++);
+    for (int i = 0; i < EVAL_BUCKET_WAYS; i++) {
+        const u64 kv = entry[i];
+        if ((kv & keyMask) == (key & keyMask)) {
+            BENCH(evalHashHits++);
+            return (short) (kv & valueMask);
+        }
+    }
     return noHashValue;
 }
 
-short Eval::getScore(const u64 key, const int side, const int N_PIECE, const int alpha, const int beta,
-                     const bool trace) {
+HOT_KERNEL short Eval::getScore(const u64 key, const int side, const int alpha, const int beta, const bool trace) {
     BENCH(evalTime.start());
     const short hashValue = getHashValue(key);
     if (hashValue != noHashValue) {
         BENCH(evalTime.stop());
         return side ? -hashValue : hashValue;
     }
-    int lazyscore_white = lazyEvalSide<WHITE>();
-    int lazyscore_black = lazyEvalSide<BLACK>();
+    const _Tmaterial &material = getMaterial();
+    if (material.endgame != NO_ENDGAME && material.endgame != OPPOSITE_BISHOPS) {
+        BENCH(evalTime.stop());
+        return evaluateEndgame(material, side);
+    }
+    int lazyscore_white = material.value[WHITE];
+    int lazyscore_black = material.value[BLACK];
     int lazyscore = lazyscore_black - lazyscore_white;
     if (side) {
         lazyscore = -lazyscore;
@@ -538,25 +753,18 @@ short Eval::getScore(const u64 key, const int side, const int N_PIECE, const int
     memset(&SCORE_DEBUG, 0, sizeof(_TSCORE_DEBUG));
 #endif
     memset(structureEval.kingSecurity, 0, sizeof(structureEval.kingSecurity));
-    int npieces = getNpiecesNoPawnNoKing<WHITE>() + getNpiecesNoPawnNoKing<BLACK>();
-    _Tphase phase;
-    if (npieces < 4) {
-        phase = END;
-    } else if (npieces < 11) {
-        phase = MIDDLE;
-    } else {
-        phase = OPEN;
-    }
+    const _Tphase phase = (_Tphase) material.phase;
     structureEval.allPiecesNoPawns[BLACK] = getBitmapNoPawns<BLACK>();
     structureEval.allPiecesNoPawns[WHITE] = getBitmapNoPawns<WHITE>();
-    structureEval.allPiecesSide[BLACK] = structureEval.allPiecesNoPawns[BLACK] | chessboard[PAWN_BLACK];
-    structureEval.allPiecesSide[WHITE] = structureEval.allPiecesNoPawns[WHITE] | chessboard[PAWN_WHITE];
-    structureEval.allPieces = structureEval.allPiecesSide[BLACK] | structureEval.allPiecesSide[WHITE];
+    structureEval.allPiecesSide[BLACK] = getBitmap<BLACK>();
+    structureEval.allPiecesSide[WHITE] = getBitmap<WHITE>();
+    structureEval.allPieces = getAllPieces();
     structureEval.posKing[BLACK] = (uchar) BITScanForward(chessboard[KING_BLACK]);
     structureEval.posKing[WHITE] = (uchar) BITScanForward(chessboard[KING_WHITE]);
     structureEval.posKingBit[BLACK] = POW2[structureEval.posKing[BLACK]];
     structureEval.posKingBit[WHITE] = POW2[structureEval.posKing[WHITE]];
     structureEval.kingAttackers[WHITE] = structureEval.kingAttackers[BLACK] = 0;
+    pawnEntry = &probePawnHash();
 
     openFile<WHITE>();
     openFile<BLACK>();
@@ -569,10 +777,9 @@ short Eval::getScore(const u64 key, const int side, const int N_PIECE, const int
         case END :
             getRes<END>(Tresult);
             break;
-        case MIDDLE:
-            getRes<MIDDLE>(Tresult);
-            break;
         default:
+            ASSERT(phase == MIDDLE);
+            getRes<MIDDLE>(Tresult);
             break;
     }
     int bonus_attack_king_black = 0;
@@ -595,6 +802,10 @@ short Eval::getScore(const u64 key, const int side, const int N_PIECE, const int
         (mobWhite + attack_king_white + bonus_attack_king_white + lazyscore_white + Tresult.pawns[WHITE] +
             Tresult.knights[WHITE] + Tresult.bishop[WHITE] + Tresult.rooks[WHITE] + Tresult.queens[WHITE] +
             Tresult.kings[WHITE]);
+    if (material.endgame == OPPOSITE_BISHOPS &&
+        colors(BITScanForward(chessboard[BISHOP_BLACK])) != colors(BITScanForward(chessboard[BISHOP_WHITE]))) {
+        result /= 2;
+    }
 
 #ifdef DEBUG_MODE
     if (trace) {
@@ -22,6 +22,7 @@
 #include <fstream>
 #include <string.h>
 #include <iomanip>
+#include <mutex>
 
 using namespace _board;
 
@@ -33,6 +34,14 @@ public:
 
     virtual ~Eval();
 
+    static constexpr int EVAL_HASH_SIZE_DEFAULT = 512;
+
+    void setEvalHashSize(const int kb);
+
+    void clearEvalHash() {
+        memset(evalHash, 0, (evalHashMask + 1) * sizeof(_TevalBucket));
+    }
+
 #ifdef BENCH_MODE
     static Time evalTime;
     static Time bishopTime;
@@ -41,15 +50,54 @@ public:
     static Time rookTime;
     static Time knightTime;
     static Time queenTime;
+    static u64 pawnHashProbes;
+    static u64 pawnHashHits;
+    static u64 evalHashProbes;
+    static u64 evalHashHits;
 #endif
 
-    short getScore(const u64 key, const int side, const int N_PIECE, const int alpha, const int beta, const bool trace);
+    short getScore(const u64 key, const int side, const int alpha, const int beta, const bool trace);
 
     template<int side>
     int lazyEval() {
         return lazyEvalSide<side>() - lazyEvalSide<side ^ 1>();
     }
 
+    /// material of each side, game phase, draw flags and endgame recognizer of a material signature
+    typedef struct {
+        short value[2];
+        uchar phase;
+        uchar flags;
+        uchar endgame;
+        uchar strongSide;
+    } _Tmaterial;
+
+    enum _Tendgame {
+        NO_ENDGAME, KPK, KBNK, KXK, OPPOSITE_BISHOPS
+    };
+
+    static constexpr uchar MATERIAL_DRAW = 1;
+
+    const _Tmaterial &getMaterial() {
+        const u64 key = chessboard[MATERIAL_IDX];
+        ASSERT(key == getMaterialKey());
+        if (!(((key >> 24) + MATERIAL_BIAS) & MATERIAL_GUARD)) {
+            return materialTable[key & MATERIAL_INDEX_MASK];
+        }
+        int count[12];
+        for (int i = 0; i < 12; i++) {
+            count[i] = bitCount(chessboard[i]);
+        }
+        setMaterial(materialOverflow, count);
+        return materialOverflow;
+    }
+
+    /// insufficient material, or a KPK the bitbase scores as a draw with side to move
+    bool isMaterialDraw(const int side) {
+        const _Tmaterial &material = getMaterial();
+        return (material.flags & MATERIAL_DRAW) || (material.endgame == KPK && isKpkDraw(material.strongSide, side));
+    }
+
 #ifdef DEBUG_MODE
     unsigned lazyEvalCuts;
 #endif
@@ -84,6 +132,10 @@ protected:
     STATIC_CONST int ROOK_TRAPPED = 6;
     STATIC_CONST int UNDEVELOPED_KNIGHT = 4;
     STATIC_CONST int UNDEVELOPED_BISHOP = 4;
+    STATIC_CONST int KNOWN_WIN = VALUEROOK;
+    STATIC_CONST int MOP_UP_KING = 8;
+    STATIC_CONST int MOP_UP_CORNER = 20;
+    static constexpr u64 CORNERS = 0x8100000000000081ULL;
 #ifdef DEBUG_MODE
     typedef struct {
         int BAD_BISHOP[2];
@@ -137,12 +189,62 @@ protected:
 #endif
 
 private:
-    static constexpr int hashSize = 65536;
+    static constexpr int EVAL_BUCKET_WAYS = 4;
     static constexpr u64 keyMask = 0xffffffffffff0000ULL;
     static constexpr u64 valueMask = 0xffffULL;
     static constexpr short noHashValue = (short) 0xffff;
 
-    static u64 *evalHash;
+    /// entries of the high 48 bits of the key and the score
+    typedef struct {
+        u64 entry[EVAL_BUCKET_WAYS];
+    } _TevalBucket;
+
+    /// one for each thread, small enough to stay in the core's own cache
+    _TevalBucket *evalHash;
+    u64 evalHashMask;
+
+    /// pawn-only terms of a pawn structure and its bitboards, one cache line
+    typedef struct {
+        u64 key;
+        u64 passed[2];
+        u64 attacks[2];
+        /// files holding a pawn of each side
+        u64 files[2];
+        /// unprotected, isolated, doubled, backward and passed pawns
+        short score[2];
+    } _TpawnEntry;
+
+    static constexpr int PAWN_HASH_SIZE = 8192;
+    _TpawnEntry *pawnHash;
+    /// entry of the position being evaluated
+    const _TpawnEntry *pawnEntry;
+
+    const _TpawnEntry &probePawnHash();
+
+    template<int side>
+    void evaluatePawnStructure(_TpawnEntry &entry);
+
+    static _Tmaterial materialTable[MATERIAL_TABLE_SIZE];
+    static bool materialGenerated;
+    static mutex mutexMaterial;
+    _Tmaterial materialOverflow;
+
+    static void setMaterial(_Tmaterial &material, const int count[12]);
+
+    u64 getMaterialKey() const;
+
+    bool isKpkDraw(const int strongSide, const int side) const;
+
+    int evaluateEndgame(const _Tmaterial &material, const int side);
+
+    static int distance(const int a, const int b) {
+        return max(abs((a >> 3) - (b >> 3)), abs((a & 7) - (b & 7)));
+    }
+
+    /// 0 in the center, 3 on the edge
+    static int centerDistance(const int a) {
+        return max(abs(2 * (a >> 3) - 7), abs(2 * (a & 7) - 7)) / 2;
+    }
 
     inline void storeHashValue(const u64 key, const short value);
 
@@ -221,19 +323,13 @@ private:
 
     template<int side>
     int lazyEvalSide() {
-        return bitCount(chessboard[PAWN_BLACK + side]) * VALUEPAWN +
-            bitCount(chessboard[ROOK_BLACK + side]) * VALUEROOK +
-            bitCount(chessboard[BISHOP_BLACK + side]) * VALUEBISHOP +
-            bitCount(chessboard[KNIGHT_BLACK + side]) * VALUEKNIGHT +
-            bitCount(chessboard[QUEEN_BLACK + side]) * VALUEQUEEN;
+        return getMaterial().value[side];
     }
-
-    void generateLinkRook();
 };
 
 namespace _eval {
 
-    constexpr int BISHOP_OUTPOST[2][64] = {
+    constexpr char BISHOP_OUTPOST[2][64] = {
         {0, 0, 0, 0, 0, 0, 0, 0,
          0, 0, 0, 0, 0, 0, 0, 0,
          0, 1, 3, 3, 3, 3, 1, 0,
@@ -252,7 +348,7 @@ namespace _eval {
          0, 0, 0, 0, 0, 0, 0, 0}
     };
 
-    constexpr int KNIGHT_OUTPOST[2][64] = {
+    constexpr char KNIGHT_OUTPOST[2][64] = {
         {0, 0, 0, 0, 0, 0, 0, 0,
          0, 0, 0, 0, 0, 0, 0, 0,
          0, 1, 4, 4, 4, 4, 1, 0,
@@ -421,947 +517,4 @@ namespace _eval {
                                                       12, 12, 16, 20, 20, 16, 12, 12, 12, 12, 16, 16, 16, 16, 12, 12,
                                                       12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12};
 
-    static constexpr u64 LINK_ROOKS[64][64] = {
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2ULL, 0x6ULL, 0xeULL, 0x1eULL, 0x3eULL, 0x7eULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x100ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10100ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010100ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x101010100ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10101010100ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010101010100ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4ULL, 0xcULL, 0x1cULL, 0x3cULL, 0x7cULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20200ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020200ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202020200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20202020200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020202020200ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0x2ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8ULL, 0x18ULL, 0x38ULL, 0x78ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x40400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040400ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404040400ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4040404040400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0x6ULL, 0x4ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10ULL, 0x30ULL, 0x70ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80800ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8080800ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808080800ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080800ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080808080800ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xeULL, 0xcULL, 0x8ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20ULL, 0x60ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10101000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x1010101000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101010101000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10101010101000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0x1eULL, 0x1cULL, 0x18ULL, 0x10ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x40ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x2000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20202000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020202000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x202020202000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x20202020202000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0x3eULL, 0x3cULL, 0x38ULL, 0x30ULL, 0x20ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x40404000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040404000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404040404000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040404000ULL, 0xffffffffffffffffULL},
-        {0x7eULL, 0x7cULL, 0x78ULL, 0x70ULL, 0x60ULL, 0x40ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x80808000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080808000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808080808000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080808000ULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x200ULL, 0x600ULL, 0xe00ULL, 0x1e00ULL, 0x3e00ULL, 0x7e00ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101010000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x10101010000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010101010000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x400ULL, 0xc00ULL, 0x1c00ULL, 0x3c00ULL,
-         0x7c00ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202020000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20202020000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x2020202020000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x200ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800ULL, 0x1800ULL, 0x3800ULL, 0x7800ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4040000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404040000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040404040000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x600ULL, 0x400ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000ULL, 0x3000ULL, 0x7000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x808080000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080808080000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xe00ULL, 0xc00ULL,
-         0x800ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000ULL, 0x6000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x100000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10100000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010100000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x101010100000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x10101010100000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1e00ULL,
-         0x1c00ULL, 0x1800ULL, 0x1000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x4000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x200000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20200000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020200000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202020200000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20202020200000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x3e00ULL,
-         0x3c00ULL, 0x3800ULL, 0x3000ULL, 0x2000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x400000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40400000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4040400000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404040400000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040400000ULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x7e00ULL,
-         0x7c00ULL, 0x7800ULL, 0x7000ULL, 0x6000ULL, 0x4000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80800000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8080800000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808080800000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080800000ULL},
-        {0x100ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20000ULL, 0x60000ULL, 0xe0000ULL, 0x1e0000ULL, 0x3e0000ULL, 0x7e0000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10101000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x1010101000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0x200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40000ULL, 0xc0000ULL, 0x1c0000ULL, 0x3c0000ULL, 0x7c0000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x2000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20202000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020202000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80000ULL, 0x180000ULL, 0x380000ULL, 0x780000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x404000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040404000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x60000ULL, 0x40000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x100000ULL, 0x300000ULL, 0x700000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x80808000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080808000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xe0000ULL, 0xc0000ULL, 0x80000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x200000ULL, 0x600000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101010000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x10101010000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x2000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1e0000ULL, 0x1c0000ULL, 0x180000ULL,
-         0x100000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x400000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202020000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20202020000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x3e0000ULL, 0x3c0000ULL, 0x380000ULL,
-         0x300000ULL, 0x200000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4040000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404040000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040000000ULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x7e0000ULL, 0x7c0000ULL, 0x780000ULL,
-         0x700000ULL, 0x600000ULL, 0x400000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8080000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808080000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080000000ULL},
-        {0x10100ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000ULL,
-         0x6000000ULL, 0xe000000ULL, 0x1e000000ULL, 0x3e000000ULL, 0x7e000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x100000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10100000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x1010100000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0x20200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4000000ULL, 0xc000000ULL, 0x1c000000ULL, 0x3c000000ULL, 0x7c000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x200000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20200000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020200000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x40000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8000000ULL, 0x18000000ULL, 0x38000000ULL, 0x78000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x400000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40400000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040400000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80800ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x6000000ULL, 0x4000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10000000ULL, 0x30000000ULL, 0x70000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80800000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8080800000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x100000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xe000000ULL, 0xc000000ULL, 0x8000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000000ULL, 0x60000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x10101000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x202000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x200000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1e000000ULL, 0x1c000000ULL, 0x18000000ULL, 0x10000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20202000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x400000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x3e000000ULL, 0x3c000000ULL, 0x38000000ULL, 0x30000000ULL,
-         0x20000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404000000000ULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x7e000000ULL, 0x7c000000ULL, 0x78000000ULL, 0x70000000ULL,
-         0x60000000ULL, 0x40000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x808000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x80808000000000ULL},
-        {0x1010100ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x200000000ULL, 0x600000000ULL,
-         0xe00000000ULL, 0x1e00000000ULL, 0x3e00000000ULL, 0x7e00000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0x2020200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x400000000ULL,
-         0xc00000000ULL, 0x1c00000000ULL, 0x3c00000000ULL, 0x7c00000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4040000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x200000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x800000000ULL, 0x1800000000ULL, 0x3800000000ULL, 0x7800000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x40000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080800ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x600000000ULL, 0x400000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x1000000000ULL, 0x3000000000ULL, 0x7000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8080000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10101000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10100000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xe00000000ULL, 0xc00000000ULL, 0x800000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000000ULL, 0x6000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x100000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10100000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20202000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20200000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x1e00000000ULL, 0x1c00000000ULL, 0x1800000000ULL, 0x1000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x200000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20200000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x40400000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x3e00000000ULL, 0x3c00000000ULL, 0x3800000000ULL, 0x3000000000ULL, 0x2000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x400000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x40400000000000ULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80800000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x80000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x7e00000000ULL, 0x7c00000000ULL, 0x7800000000ULL, 0x7000000000ULL, 0x6000000000ULL,
-         0x4000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x800000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x80800000000000ULL},
-        {0x101010100ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101010000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x100000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000000000ULL, 0x60000000000ULL, 0xe0000000000ULL,
-         0x1e0000000000ULL, 0x3e0000000000ULL, 0x7e0000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0x202020200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202020000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x200000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40000000000ULL, 0xc0000000000ULL,
-         0x1c0000000000ULL, 0x3c0000000000ULL, 0x7c0000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404040400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x404040000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x400000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80000000000ULL, 0x180000000000ULL,
-         0x380000000000ULL, 0x780000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808080800ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808080000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x808000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x60000000000ULL,
-         0x40000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x100000000000ULL,
-         0x300000000000ULL, 0x700000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8000000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010101000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010100000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x1000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xe0000000000ULL,
-         0xc0000000000ULL, 0x80000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x200000000000ULL, 0x600000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x10000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x2020202000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020200000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1e0000000000ULL,
-         0x1c0000000000ULL, 0x180000000000ULL, 0x100000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x400000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040404000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4040400000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x3e0000000000ULL,
-         0x3c0000000000ULL, 0x380000000000ULL, 0x300000000000ULL, 0x200000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x40000000000000ULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080808000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080800000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8080000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x7e0000000000ULL,
-         0x7c0000000000ULL, 0x780000000000ULL, 0x700000000000ULL, 0x600000000000ULL, 0x400000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x80000000000000ULL},
-        {0x10101010100ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10101010000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10101000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x10100000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x2000000000000ULL, 0x6000000000000ULL, 0xe000000000000ULL, 0x1e000000000000ULL,
-         0x3e000000000000ULL, 0x7e000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0x20202020200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20202020000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20202000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20200000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000000000000ULL, 0xc000000000000ULL, 0x1c000000000000ULL,
-         0x3c000000000000ULL, 0x7c000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x40404040000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40400000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8000000000000ULL, 0x18000000000000ULL, 0x38000000000000ULL,
-         0x78000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080800ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x80808000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80800000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x6000000000000ULL, 0x4000000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x10000000000000ULL, 0x30000000000000ULL,
-         0x70000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101010101000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101010100000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x101010000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x101000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x100000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xe000000000000ULL, 0xc000000000000ULL,
-         0x8000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x20000000000000ULL,
-         0x60000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x202020202000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202020200000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202020000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x202000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x200000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1e000000000000ULL, 0x1c000000000000ULL,
-         0x18000000000000ULL, 0x10000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x40000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404040404000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x404040400000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404040000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x404000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x400000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x3e000000000000ULL, 0x3c000000000000ULL,
-         0x38000000000000ULL, 0x30000000000000ULL, 0x20000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808080808000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808080800000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x808080000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x808000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x7e000000000000ULL, 0x7c000000000000ULL,
-         0x78000000000000ULL, 0x70000000000000ULL, 0x60000000000000ULL, 0x40000000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL},
-        {0x1010101010100ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010101010000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010101000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x1010100000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1010000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x200000000000000ULL, 0x600000000000000ULL, 0xe00000000000000ULL, 0x1e00000000000000ULL, 0x3e00000000000000ULL,
-         0x7e00000000000000ULL},
-        {0xffffffffffffffffULL, 0x2020202020200ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020202020000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020202000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2020200000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x2020000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2000000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x400000000000000ULL, 0xc00000000000000ULL, 0x1c00000000000000ULL,
-         0x3c00000000000000ULL, 0x7c00000000000000ULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040404040400ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4040404040000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040404000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040400000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4040000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x4000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x200000000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800000000000000ULL, 0x1800000000000000ULL,
-         0x3800000000000000ULL, 0x7800000000000000ULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080808080800ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080808080000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x8080808000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080800000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8080000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x8000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x600000000000000ULL, 0x400000000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x1000000000000000ULL,
-         0x3000000000000000ULL, 0x7000000000000000ULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x10101010101000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x10101010100000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x10101010000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x10101000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x10100000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x10000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xe00000000000000ULL, 0xc00000000000000ULL, 0x800000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x2000000000000000ULL, 0x6000000000000000ULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20202020202000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20202020200000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20202020000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20202000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20200000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0x20000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x1e00000000000000ULL, 0x1c00000000000000ULL, 0x1800000000000000ULL, 0x1000000000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x4000000000000000ULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040404000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040400000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404040000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40404000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40400000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x40000000000000ULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x3e00000000000000ULL, 0x3c00000000000000ULL, 0x3800000000000000ULL, 0x3000000000000000ULL,
-         0x2000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
-        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080808000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080800000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808080000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80808000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80800000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x80000000000000ULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
-         0x7e00000000000000ULL, 0x7c00000000000000ULL, 0x7800000000000000ULL, 0x7000000000000000ULL,
-         0x6000000000000000ULL, 0x4000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL}
-    };
-
 }
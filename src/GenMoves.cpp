@@ -20,35 +20,27 @@
 #include "Eval.h"
 #include "util/Bitboard.h"
 
-bool GenMoves::forceCheck = false;
-
-GenMoves::GenMoves() : perftMode(false), listId(-1) {
+GenMoves::GenMoves() : pinned(0), listId(-1), isInCheck(false), evasionMask(0xffffffffffffffffULL) {
     currentPly = 0;
-    gen_list = (_TmoveP *) calloc(MAX_PLY, sizeof(_TmoveP));
+    gen_list = (_TmoveP *) alignedMalloc(MAX_PLY * sizeof(_TmoveP));
     _assert(gen_list);
+    memset(gen_list, 0, MAX_PLY * sizeof(_TmoveP));
     for (int i = 0; i < MAX_PLY; i++) {
-        gen_list[i].moveList = (_Tmove *) calloc(MAX_MOVE, sizeof(_Tmove));
+        gen_list[i].moveList = (_Tmove *) alignedMalloc(MAX_MOVE * sizeof(_Tmove));
         _assert(gen_list[i].moveList);
+        gen_list[i].score = (int *) alignedMalloc(MAX_MOVE * sizeof(int));
+        _assert(gen_list[i].score);
     }
-    repetitionMap = (u64 *) malloc(sizeof(u64) * MAX_REP_COUNT);
+    repetitionMap = (u64 *) alignedMalloc(sizeof(u64) * MAX_REP_COUNT);
     _assert(repetitionMap);
-    repetitionMapCount = 0;
-}
-
-bool GenMoves::performRankFileCapture(const int piece, const u64 enemies, const int side, const u64 allpieces) {
-    ASSERT_RANGE(piece, 0, 11);
-    ASSERT_RANGE(side, 0, 1);
-
-    for (u64 x2 = chessboard[piece]; x2; RESET_LSB(x2)) {
-        const int position = BITScanForward(x2);
-        u64 rankFile = getRankFile(position, allpieces) & enemies;;
-        for (; rankFile; RESET_LSB(rankFile)) {
-            if (pushmove<STANDARD_MOVE_MASK>(position, BITScanForward(rankFile), side, NO_PROMOTION, piece)) {
-                return true;
-            }
-        }
-    }
-    return false;
+    fiftyMoveMap = (int *) alignedMalloc(sizeof(int) * MAX_REP_COUNT);
+    _assert(fiftyMoveMap);
+#ifdef COPY_MAKE
+    boardStack = (_TboardCopy *) alignedMalloc(sizeof(_TboardCopy) * (BOARD_STACK_MASK + 1));
+    _assert(boardStack);
+#endif
+    setRepetitionMapCount(0);
+    clearHistoryHeuristic();
 }
 
 u64 GenMoves::performRankFileCaptureAndShift(const int position, const u64 enemies, const u64 allpieces) {
@@ -58,54 +50,21 @@ u64 GenMoves::performRankFileCaptureAndShift(const int position, const u64 enemi
     return rankFile;
 }
 
-bool GenMoves::performDiagCapture(const int piece, const u64 enemies, const int side, const u64 allpieces) {
-    ASSERT_RANGE(piece, 0, 11);
-    ASSERT_RANGE(side, 0, 1);
-    for (u64 x2 = chessboard[piece]; x2; RESET_LSB(x2)) {
-        const int position = BITScanForward(x2);
-        u64 diag = getDiagonalAntiDiagonal(position, allpieces) & enemies;
-        for (; diag; RESET_LSB(diag)) {
-            if (pushmove<STANDARD_MOVE_MASK>(position, BITScanForward(diag), side, NO_PROMOTION, piece)) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-void GenMoves::performRankFileShift(const int piece, const int side, const u64 allpieces) {
-    ASSERT_RANGE(piece, 0, 11);
-    ASSERT_RANGE(side, 0, 1);
-
-    for (u64 x2 = chessboard[piece]; x2; RESET_LSB(x2)) {
-        const int position = BITScanForward(x2);
-        u64 rankFile = getRankFile(position, allpieces) & ~allpieces;
-        for (; rankFile; RESET_LSB(rankFile)) {
-            pushmove<STANDARD_MOVE_MASK>(position, BITScanForward(rankFile), side, NO_PROMOTION, piece);
-        }
-    }
-}
-
-void GenMoves::performDiagShift(const int piece, const int side, const u64 allpieces) {
-    ASSERT_RANGE(piece, 0, 11);
-    ASSERT_RANGE(side, 0, 1);
-    for (u64 x2 = chessboard[piece]; x2; RESET_LSB(x2)) {
-        const int position = BITScanForward(x2);
-        u64 diag = getDiagonalAntiDiagonal(position, allpieces) & ~allpieces;
-        for (; diag; RESET_LSB(diag)) {
-            pushmove<STANDARD_MOVE_MASK>(position, BITScanForward(diag), side, NO_PROMOTION, piece);
-        }
+int GenMoves::generateLegalMoves(_TmoveBuffer &buffer) {
+    // capture generation consumes the en passant square, give it back with its key term
+    const u64 oldKey = chessboard[ZOBRISTKEY_IDX];
+    const u64 oldEnpassant = chessboard[ENPASSANT_IDX];
+    _TmoveP list = {buffer.moveList, buffer.score, 0};
+    if (getSide() == WHITE) {
+        generateCaptures<LEGAL_MODE, WHITE>(list, getBitmap<BLACK>(), getBitmap<WHITE>());
+        generateMoves<LEGAL_MODE, WHITE>(list, getAllPieces());
+    } else {
+        generateCaptures<LEGAL_MODE, BLACK>(list, getBitmap<WHITE>(), getBitmap<BLACK>());
+        generateMoves<LEGAL_MODE, BLACK>(list, getAllPieces());
     }
-}
-
-void GenMoves::generateMoves(const int side, const u64 allpieces) {
-    ASSERT_RANGE(side, 0, 1);
-    side ? generateMoves<WHITE>(allpieces) : generateMoves<BLACK>(allpieces);
-}
-
-bool GenMoves::generateCaptures(const int side, const u64 enemies, const u64 friends) {
-    ASSERT_RANGE(side, 0, 1);
-    return side ? generateCaptures<WHITE>(enemies, friends) : generateCaptures<BLACK>(enemies, friends);
+    chessboard[ENPASSANT_IDX] = oldEnpassant;
+    chessboard[ZOBRISTKEY_IDX] = oldKey;
+    return list.size;
 }
 
 u64 GenMoves::getMobilityQueen(const int position, const u64 enemies, const u64 allpieces) {
@@ -119,46 +78,49 @@ u64 GenMoves::getMobilityRook(const int position, const u64 enemies, const u64 f
     return performRankFileCaptureAndShift(position, enemies, enemies | friends);
 }
 
-void GenMoves::setPerft(const bool b) {
-    perftMode = b;
-}
-
 void GenMoves::clearHistoryHeuristic() {
     memset(historyHeuristic, 0, sizeof(historyHeuristic));
 }
 
+void GenMoves::ageHistoryHeuristic() {
+    for (int i = 0; i < 64; i++) {
+        for (int j = 0; j < 64; j++) {
+            historyHeuristic[i][j] >>= 3;
+        }
+    }
+}
+
+/// scans the contiguous scores for the best one, a returned move is marked by the lowest score and stays in place
 _Tmove *GenMoves::getNextMove(_TmoveP *list) {
-    _Tmove *gen_list1 = list->moveList;
-    ASSERT(gen_list1);
-    int listcount = list->size;
+    ASSERT(list->moveList && list->score);
+    int *score = list->score;
+    const int listcount = list->size;
     int bestId = -1;
-    int j, bestScore;
-    for (j = 0; j < listcount; j++) {
-        if (!gen_list1[j].used) {
-            bestId = j;
-            bestScore = gen_list1[bestId].score;
-            break;
+    int bestScore = INT_MIN;
+    for (int i = 0; i < listcount; i++) {
+        if (score[i] > bestScore) {
+            bestId = i;
+            bestScore = score[i];
         }
     }
     if (bestId == -1) {
         return nullptr;
     }
-    for (int i = j + 1; i < listcount; i++) {
-        if (!gen_list1[i].used && gen_list1[i].score > bestScore) {
-            bestId = i;
-            bestScore = gen_list1[bestId].score;
-        }
-    }
-    gen_list1[bestId].used = true;
-    return &gen_list1[bestId];
+    score[bestId] = INT_MIN;
+    return &list->moveList[bestId];
 }
 
 GenMoves::~GenMoves() {
     for (int i = 0; i < MAX_PLY; i++) {
-        free(gen_list[i].moveList);
-    }
-    free(gen_list);
-    free(repetitionMap);
+        alignedFree(gen_list[i].moveList);
+        alignedFree(gen_list[i].score);
+    }
+    alignedFree(gen_list);
+    alignedFree(repetitionMap);
+    alignedFree(fiftyMoveMap);
+#ifdef COPY_MAKE
+    alignedFree(boardStack);
+#endif
 }
 
 void GenMoves::performCastle(const int side, const uchar type) {
@@ -175,6 +137,8 @@ void GenMoves::performCastle(const int side, const uchar type) {
             updateZobristKey(ROOK_WHITE, 2);
             updateZobristKey(ROOK_WHITE, 0);
             chessboard[ROOK_WHITE] = (chessboard[ROOK_WHITE] | POW2_2) & NOTPOW2_0;
+            movePieceAt(3, 1);
+            movePieceAt(0, 2);
         } else {
             ASSERT(type & QUEEN_SIDE_CASTLE_MOVE_MASK);
             ASSERT(getPieceAt(side, POW2_3) == KING_WHITE);
@@ -188,6 +152,8 @@ void GenMoves::performCastle(const int side, const uchar type) {
             chessboard[ROOK_WHITE] = (chessboard[ROOK_WHITE] | POW2_4) & NOTPOW2_7;
             updateZobristKey(ROOK_WHITE, 4);
             updateZobristKey(ROOK_WHITE, 7);
+            movePieceAt(3, 5);
+            movePieceAt(7, 4);
         }
     } else {
         if (type & KING_SIDE_CASTLE_MOVE_MASK) {
@@ -201,6 +167,8 @@ void GenMoves::performCastle(const int side, const uchar type) {
             chessboard[ROOK_BLACK] = (chessboard[ROOK_BLACK] | POW2_58) & NOTPOW2_56;
             updateZobristKey(ROOK_BLACK, 58);
             updateZobristKey(ROOK_BLACK, 56);
+            movePieceAt(59, 57);
+            movePieceAt(56, 58);
         } else {
             ASSERT(type & QUEEN_SIDE_CASTLE_MOVE_MASK);
             ASSERT(getPieceAt(side, POW2_59) == KING_BLACK);
@@ -214,6 +182,8 @@ void GenMoves::performCastle(const int side, const uchar type) {
             chessboard[ROOK_BLACK] = (chessboard[ROOK_BLACK] | POW2_60) & NOTPOW2_63;
             updateZobristKey(ROOK_BLACK, 60);
             updateZobristKey(ROOK_BLACK, 63);
+            movePieceAt(59, 61);
+            movePieceAt(63, 60);
         }
     }
 }
@@ -249,62 +219,6 @@ int GenMoves::getMobilityCastle(const int side, const u64 allpieces) const {
     return count;
 }
 
-void GenMoves::tryAllCastle(const int side, const u64 allpieces) {
-    ASSERT_RANGE(side, 0, 1);
-    if (side == WHITE) {
-        if (POW2_3 & chessboard[KING_WHITE] && !(allpieces & 0x6ULL) &&
-            chessboard[RIGHT_CASTLE_IDX] & RIGHT_KING_CASTLE_WHITE_MASK && chessboard[ROOK_WHITE] & POW2_0 &&
-            !isAttacked<WHITE>(1, allpieces) && !isAttacked<WHITE>(2, allpieces) && !isAttacked<WHITE>(3, allpieces)) {
-            pushmove<KING_SIDE_CASTLE_MOVE_MASK>(-1, -1, WHITE, NO_PROMOTION, -1);
-        }
-        if (POW2_3 & chessboard[KING_WHITE] && !(allpieces & 0x70ULL) &&
-            chessboard[RIGHT_CASTLE_IDX] & RIGHT_QUEEN_CASTLE_WHITE_MASK && chessboard[ROOK_WHITE] & POW2_7 &&
-            !isAttacked<WHITE>(3, allpieces) && !isAttacked<WHITE>(4, allpieces) && !isAttacked<WHITE>(5, allpieces)) {
-            pushmove<QUEEN_SIDE_CASTLE_MOVE_MASK>(-1, -1, WHITE, NO_PROMOTION, -1);
-        }
-    } else {
-        if (POW2_59 & chessboard[KING_BLACK] && chessboard[RIGHT_CASTLE_IDX] & RIGHT_KING_CASTLE_BLACK_MASK &&
-            !(allpieces & 0x600000000000000ULL) && chessboard[ROOK_BLACK] & POW2_56 &&
-            !isAttacked<BLACK>(57, allpieces) && !isAttacked<BLACK>(58, allpieces) &&
-            !isAttacked<BLACK>(59, allpieces)) {
-            pushmove<KING_SIDE_CASTLE_MOVE_MASK>(-1, -1, BLACK, NO_PROMOTION, -1);
-        }
-        if (POW2_59 & chessboard[KING_BLACK] && chessboard[RIGHT_CASTLE_IDX] & RIGHT_QUEEN_CASTLE_BLACK_MASK &&
-            !(allpieces & 0x7000000000000000ULL) && chessboard[ROOK_BLACK] & POW2_63 &&
-            !isAttacked<BLACK>(59, allpieces) && !isAttacked<BLACK>(60, allpieces) &&
-            !isAttacked<BLACK>(61, allpieces)) {
-            pushmove<QUEEN_SIDE_CASTLE_MOVE_MASK>(-1, -1, BLACK, NO_PROMOTION, -1);
-        }
-    }
-}
-
-bool GenMoves::performKnightShiftCapture(const int piece, const u64 enemies, const int side) {
-    ASSERT_RANGE(piece, 0, 11);
-    ASSERT_RANGE(side, 0, 1);
-    for (u64 x = chessboard[piece]; x; RESET_LSB(x)) {
-        const int pos = BITScanForward(x);
-        for (u64 x1 = enemies & KNIGHT_MASK[pos]; x1; RESET_LSB(x1)) {
-            if (pushmove<STANDARD_MOVE_MASK>(pos, BITScanForward(x1), side, NO_PROMOTION, piece)) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-bool GenMoves::performKingShiftCapture(const int side, const u64 enemies) {
-    ASSERT_RANGE(side, 0, 1);
-    int pos = BITScanForward(chessboard[KING_BLACK + side]);
-    ASSERT(pos != -1);
-
-    for (u64 x1 = enemies & NEAR_MASK1[pos]; x1; RESET_LSB(x1)) {
-        if (pushmove<STANDARD_MOVE_MASK>(pos, BITScanForward(x1), side, NO_PROMOTION, KING_BLACK + side)) {
-            return true;
-        }
-    }
-    return false;
-}
-
 void GenMoves::unPerformCastle(const int side, const uchar type) {
     ASSERT_RANGE(side, 0, 1);
     if (side == WHITE) {
@@ -315,17 +229,25 @@ void GenMoves::unPerformCastle(const int side, const uchar type) {
             ASSERT(getPieceAt(side, POW2_2) == ROOK_WHITE);
             chessboard[KING_WHITE] = (chessboard[KING_WHITE] | POW2_3) & NOTPOW2_1;
             chessboard[ROOK_WHITE] = (chessboard[ROOK_WHITE] | POW2_0) & NOTPOW2_2;
+            movePieceAt(1, 3);
+            movePieceAt(2, 0);
         } else {
             chessboard[KING_WHITE] = (chessboard[KING_WHITE] | POW2_3) & NOTPOW2_5;
             chessboard[ROOK_WHITE] = (chessboard[ROOK_WHITE] | POW2_7) & NOTPOW2_4;
+            movePieceAt(5, 3);
+            movePieceAt(4, 7);
         }
     } else {
         if (type & KING_SIDE_CASTLE_MOVE_MASK) {
             chessboard[KING_BLACK] = (chessboard[KING_BLACK] | POW2_59) & NOTPOW2_57;
             chessboard[ROOK_BLACK] = (chessboard[ROOK_BLACK] | POW2_56) & NOTPOW2_58;
+            movePieceAt(57, 59);
+            movePieceAt(58, 56);
         } else {
             chessboard[KING_BLACK] = (chessboard[KING_BLACK] | POW2_59) & NOTPOW2_61;
             chessboard[ROOK_BLACK] = (chessboard[ROOK_BLACK] | POW2_63) & NOTPOW2_60;
+            movePieceAt(61, 59);
+            movePieceAt(60, 63);
         }
     }
 }
@@ -334,8 +256,15 @@ void GenMoves::takeback(_Tmove *move, const u64 oldkey, bool rep) {
     if (rep) {
         popStackMove();
     }
+#ifdef COPY_MAKE
+    const _TboardCopy &copy = boardStack[--boardStackIdx & BOARD_STACK_MASK];
+    memcpy(chessboard, copy.chessboard, sizeof(_Tchessboard));
+    memcpy(mailbox, copy.mailbox, sizeof(mailbox));
+#endif
+    // key and en passant as make/unmake leaves them, capture generation has already cleared the square
     chessboard[ZOBRISTKEY_IDX] = oldkey;
     chessboard[ENPASSANT_IDX] = NO_ENPASSANT;
+#ifndef COPY_MAKE
     int pieceFrom, posTo, posFrom, movecapture;
     chessboard[RIGHT_CASTLE_IDX] = move->type & 0xf0;
     if ((move->type & 0x3) == STANDARD_MOVE_MASK || (move->type & 0x3) == ENPASSANT_MOVE_MASK) {
@@ -346,15 +275,21 @@ void GenMoves::takeback(_Tmove *move, const u64 oldkey, bool rep) {
         ASSERT_RANGE(posTo, 0, 63);
         pieceFrom = move->pieceFrom;
         chessboard[pieceFrom] = (chessboard[pieceFrom] & NOTPOW2[posTo]) | POW2[posFrom];
+        mailbox[posFrom] = pieceFrom;
+        mailbox[posTo] = SQUARE_FREE;
         if (movecapture != SQUARE_FREE) {
+            chessboard[MATERIAL_IDX] += MATERIAL_KEY[movecapture];
             if (((move->type & 0x3) != ENPASSANT_MOVE_MASK)) {
                 chessboard[movecapture] |= POW2[posTo];
+                mailbox[posTo] = movecapture;
             } else {
-                ASSERT(movecapture == (move->side ^ 1));
-                if (move->side) {
+                ASSERT(movecapture == (move->side() ^ 1));
+                if (move->side()) {
                     chessboard[movecapture] |= POW2[posTo - 8];
+                    mailbox[posTo - 8] = movecapture;
                 } else {
                     chessboard[movecapture] |= POW2[posTo + 8];
+                    mailbox[posTo + 8] = movecapture;
                 }
             }
         }
@@ -362,21 +297,33 @@ void GenMoves::takeback(_Tmove *move, const u64 oldkey, bool rep) {
         posTo = move->to;
         posFrom = move->from;
         movecapture = move->capturedPiece;
-        ASSERT(posTo >= 0 && move->side >= 0 && move->promotionPiece >= 0);
-        chessboard[(uchar) move->side] |= POW2[posFrom];
-        chessboard[(uchar) move->promotionPiece] &= NOTPOW2[posTo];
+        pieceFrom = move->pieceFrom;
+        ASSERT(pieceFrom == move->side() && move->promotionPiece < 12);
+        chessboard[pieceFrom] |= POW2[posFrom];
+        chessboard[move->promotionPiece] &= NOTPOW2[posTo];
+        chessboard[MATERIAL_IDX] += MATERIAL_KEY[pieceFrom] - MATERIAL_KEY[move->promotionPiece];
+        mailbox[posFrom] = pieceFrom;
+        mailbox[posTo] = movecapture;
         if (movecapture != SQUARE_FREE) {
             chessboard[movecapture] |= POW2[posTo];
+            chessboard[MATERIAL_IDX] += MATERIAL_KEY[movecapture];
         }
     } else if (move->type & 0xc) { //castle
-        unPerformCastle(move->side, move->type);
+        unPerformCastle(move->side(), move->type);
     }
+#endif
+    ASSERT(checkIncremental());
 }
 
 
 bool GenMoves::makemove(const _Tmove *move, const bool rep, const bool checkInCheck) {
     ASSERT(move);
     ASSERT(bitCount(chessboard[KING_WHITE]) == 1 && bitCount(chessboard[KING_BLACK]) == 1);
+#ifdef COPY_MAKE
+    _TboardCopy &copy = boardStack[boardStackIdx++ & BOARD_STACK_MASK];
+    memcpy(copy.chessboard, chessboard, sizeof(_Tchessboard));
+    memcpy(copy.mailbox, mailbox, sizeof(mailbox));
+#endif
     int pieceFrom = SQUARE_FREE, posTo, posFrom, movecapture = SQUARE_FREE;
     uchar rightCastleOld = chessboard[RIGHT_CASTLE_IDX];
     if (!(move->type & 0xc)) { //no castle
@@ -389,26 +336,33 @@ bool GenMoves::makemove(const _Tmove *move, const bool rep, const bool checkInCh
         if ((move->type & 0x3) == PROMOTION_MOVE_MASK) {
             chessboard[pieceFrom] &= NOTPOW2[posFrom];
             updateZobristKey(pieceFrom, posFrom);
-            ASSERT(move->promotionPiece >= 0);
-            chessboard[(uchar) move->promotionPiece] |= POW2[posTo];
-            updateZobristKey((uchar) move->promotionPiece, posTo);
+            ASSERT(move->promotionPiece < 12);
+            chessboard[move->promotionPiece] |= POW2[posTo];
+            updateZobristKey(move->promotionPiece, posTo);
+            chessboard[MATERIAL_IDX] += MATERIAL_KEY[move->promotionPiece] - MATERIAL_KEY[pieceFrom];
+            mailbox[posTo] = move->promotionPiece;
         } else {
             chessboard[pieceFrom] = (chessboard[pieceFrom] | POW2[posTo]) & NOTPOW2[posFrom];
             updateZobristKey(pieceFrom, posFrom);
             updateZobristKey(pieceFrom, posTo);
+            mailbox[posTo] = pieceFrom;
         }
+        mailbox[posFrom] = SQUARE_FREE;
         if (movecapture != SQUARE_FREE) {
+            chessboard[MATERIAL_IDX] -= MATERIAL_KEY[movecapture];
             if ((move->type & 0x3) != ENPASSANT_MOVE_MASK) {
                 chessboard[movecapture] &= NOTPOW2[posTo];
                 updateZobristKey(movecapture, posTo);
             } else { //en passant
-                ASSERT(movecapture == (move->side ^ 1));
-                if (move->side) {
+                ASSERT(movecapture == (move->side() ^ 1));
+                if (move->side()) {
                     chessboard[movecapture] &= NOTPOW2[posTo - 8];
                     updateZobristKey(movecapture, posTo - 8);
+                    mailbox[posTo - 8] = SQUARE_FREE;
                 } else {
                     chessboard[movecapture] &= NOTPOW2[posTo + 8];
                     updateZobristKey(movecapture, posTo + 8);
+                    mailbox[posTo + 8] = SQUARE_FREE;
                 }
             }
         }
@@ -452,8 +406,8 @@ bool GenMoves::makemove(const _Tmove *move, const bool rep, const bool checkInCh
             default:;
         }
     } else { //castle
-        performCastle(move->side, move->type);
-        if (move->side == WHITE) {
+        performCastle(move->side(), move->type);
+        if (move->side() == WHITE) {
             chessboard[RIGHT_CASTLE_IDX] &= 0xcf;
         } else {
             chessboard[RIGHT_CASTLE_IDX] &= 0x3f;
@@ -464,14 +418,18 @@ bool GenMoves::makemove(const _Tmove *move, const bool rep, const bool checkInCh
         const int position = BITScanForward(x2);
         updateZobristKey(14, position);
     }
+    ASSERT(checkIncremental());
     if (rep) {
+        const int oldFiftyMoveCount = fiftyMoveCount;
         if (movecapture != SQUARE_FREE || pieceFrom == WHITE || pieceFrom == BLACK || move->type & 0xc) {
-            pushStackMove(0);
+            fiftyMoveCount = 0;
+        } else {
+            fiftyMoveCount++;
         }
-        pushStackMove(chessboard[ZOBRISTKEY_IDX]);
+        pushStackMove(chessboard[ZOBRISTKEY_IDX], oldFiftyMoveCount);
     }
-    if ((forceCheck || (checkInCheck && !perftMode)) &&
-        ((move->side == WHITE && inCheck<WHITE>()) || (move->side == BLACK && inCheck<BLACK>()))) {
+    if (checkInCheck &&
+        ((move->side() == WHITE && inCheck<WHITE>()) || (move->side() == BLACK && inCheck<BLACK>()))) {
         return false;
     }
     return true;
@@ -492,16 +450,21 @@ u64 GenMoves::getTotMoves() const {
 }
 
 void GenMoves::setRepetitionMapCount(const int i) {
+    ASSERT_RANGE(i, 0, MAX_REP_COUNT - 1);
     repetitionMapCount = i;
+    memset(repetitionFilter, 0, sizeof(repetitionFilter));
+    for (int k = 0; k < repetitionMapCount; k++) {
+        repetitionFilter[repetitionMap[k] & REPETITION_FILTER_MASK]++;
+    }
 }
 
-int GenMoves::loadFen(string fen) {
-    repetitionMapCount = 0;
-    int side = ChessBoard::loadFen(fen);
-    if (side == 2) {
-        fatal("Bad FEN position format ", fen);
-        std::_Exit(1);
+int GenMoves::loadFen(const string &fen) {
+    const int side = ChessBoard::loadFen(fen);
+    if (side == FEN_ERROR) {
+        error("Bad FEN position format ", fen);
+        return side;
     }
+    setRepetitionMapCount(0);
     return side;
 }
 
@@ -521,21 +484,21 @@ int GenMoves::getMoveFromSan(const string fenStr, _Tmove *move) {
             getPieceAt<BLACK>(POW2[E8]) == KING_BLACK)) {
         if (MATCH_QUEENSIDE.find(fenStr) != string::npos) {
             move->type = QUEEN_SIDE_CASTLE_MOVE_MASK;
-            move->from = QUEEN_SIDE_CASTLE_MOVE_MASK;
         } else {
-            move->from = KING_SIDE_CASTLE_MOVE_MASK;
             move->type = KING_SIDE_CASTLE_MOVE_MASK;
         }
         if (fenStr.find("1") != string::npos) {
-            move->side = WHITE;
+            move->pieceFrom = KING_WHITE;
         } else if (fenStr.find("8") != string::npos) {
-            move->side = BLACK;
+            move->pieceFrom = KING_BLACK;
         } else {
             _assert(0);
         }
-        move->from = -1;
+        const int side = move->side();
+        move->from = side ? E1 : E8;
+        move->to = move->type == KING_SIDE_CASTLE_MOVE_MASK ? (side ? G1 : G8) : (side ? C1 : C8);
         move->capturedPiece = SQUARE_FREE;
-        return move->side;
+        return move->side();
     }
     int from = -1;
     int to = -1;
@@ -560,44 +523,34 @@ int GenMoves::getMoveFromSan(const string fenStr, _Tmove *move) {
         _assert(0);
     }
     int pieceFrom;
-    if ((pieceFrom = getPieceAt<WHITE>(POW2[from])) != 12) {
-        move->side = WHITE;
-    } else if ((pieceFrom = getPieceAt<BLACK>(POW2[from])) != 12) {
-        move->side = BLACK;
-    } else {
+    if ((pieceFrom = getPieceAt<WHITE>(POW2[from])) == SQUARE_FREE &&
+        (pieceFrom = getPieceAt<BLACK>(POW2[from])) == SQUARE_FREE) {
         cout << "fenStr: " << fenStr << " from: " << from << endl;
         _assert(0);
     }
     move->from = from;
     move->to = to;
+    move->pieceFrom = pieceFrom;
+    const int side = move->side();
     if (fenStr.length() == 4) {
         move->type = STANDARD_MOVE_MASK;
         if (pieceFrom == PAWN_WHITE || pieceFrom == PAWN_BLACK) {
             if (FILE_AT[from] != FILE_AT[to] &&
-                (move->side ^ 1 ? getPieceAt<WHITE>(POW2[to]) : getPieceAt<BLACK>(POW2[to])) == SQUARE_FREE) {
+                (side ^ 1 ? getPieceAt<WHITE>(POW2[to]) : getPieceAt<BLACK>(POW2[to])) == SQUARE_FREE) {
                 move->type = ENPASSANT_MOVE_MASK;
             }
         }
     } else if (fenStr.length() == 5) {
         move->type = PROMOTION_MOVE_MASK;
-        if (move->side == WHITE) {
-            move->promotionPiece = INV_FEN[toupper(fenStr.at(4))];
-        } else {
-            move->promotionPiece = INV_FEN[(uchar) fenStr.at(4)];
-        }
-        ASSERT(move->promotionPiece != -1);
-    }
-    if (move->side == WHITE) {
-        move->capturedPiece = getPieceAt<BLACK>(POW2[move->to]);
-        move->pieceFrom = getPieceAt<WHITE>(POW2[move->from]);
-    } else {
-        move->capturedPiece = getPieceAt<WHITE>(POW2[move->to]);
-        move->pieceFrom = getPieceAt<BLACK>(POW2[move->from]);
+        const int promotionPiece = side == WHITE ? INV_FEN[toupper(fenStr.at(4))] : INV_FEN[(uchar) fenStr.at(4)];
+        ASSERT(promotionPiece != -1);
+        move->promotionPiece = promotionPiece;
     }
+    move->capturedPiece = side == WHITE ? getPieceAt<BLACK>(POW2[to]) : getPieceAt<WHITE>(POW2[to]);
     if (move->type == ENPASSANT_MOVE_MASK) {
-        move->capturedPiece = !move->side;
+        move->capturedPiece = side ^ 1;
     }
-    return move->side;
+    return side;
 }
 
 void GenMoves::writeRandomFen(const vector<int> pieces) {
@@ -612,7 +565,7 @@ void GenMoves::writeRandomFen(const vector<int> pieces) {
             chessboard[pieces[i]] |= POW2[rand() % 64];
             check |= chessboard[pieces[i]];
         }
-
+        initIncremental();
         if (bitCount(check) == (2 + (int) pieces.size()) && !inCheck<WHITE>() && !inCheck<BLACK>() &&
             !(0xff000000000000ffULL & (chessboard[0] | chessboard[1]))) {
             cout << boardToFen() << "\n";
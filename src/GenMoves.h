@@ -25,89 +25,135 @@
 class GenMoves: public ChessBoard {
 
 public:
-    static const int MAX_MOVE = 130;
+    static constexpr uchar STANDARD_MOVE_MASK = 0x3;
+    static constexpr uchar ENPASSANT_MOVE_MASK = 0x1;
+    static constexpr uchar PROMOTION_MOVE_MASK = 0x2;
 
     GenMoves();
 
     virtual ~GenMoves();
 
-    void setPerft(const bool b);
+    /// what a generation lists: PERFT_MODE every promotion and no ordering scores, SEARCH_MODE queen promotions only,
+    /// scored for ordering, LEGAL_MODE the complete unscored list handed out by generateLegalMoves
+    enum _TgenMode {
+        PERFT_MODE, SEARCH_MODE, LEGAL_MODE
+    };
 
-    bool generateCaptures(const int side, u64, u64);
+    _Tchessboard &getChessboard() {
+        return chessboard;
+    }
 
-    bool generateCapturesMoves();
+    /// every legal move of the side to move into the caller's buffer, returns the count, the search move lists
+    /// and the board are not touched. Call clearEnpassant() before making the moves
+    int generateLegalMoves(_TmoveBuffer &buffer);
 
-    void generateMoves(const int side, const u64);
+    /// drops the en passant square and its key term, as capture generation does before a node makes its moves
+    void clearEnpassant() {
+        if (chessboard[ENPASSANT_IDX] != NO_ENPASSANT) {
+            updateZobristKey(13, chessboard[ENPASSANT_IDX]);
+            chessboard[ENPASSANT_IDX] = NO_ENPASSANT;
+        }
+    }
 
-    _Tchessboard &getChessboard() {
-        return chessboard;
+    template<_TgenMode mode>
+    void generateMoves(const int side, const u64 allpieces) {
+        ASSERT_RANGE(side, 0, 1);
+        side ? generateMoves<mode, WHITE>(allpieces) : generateMoves<mode, BLACK>(allpieces);
     }
 
-    template<int side>
+    template<_TgenMode mode>
+    bool generateCaptures(const int side, const u64 enemies, const u64 friends) {
+        ASSERT_RANGE(side, 0, 1);
+        return side ? generateCaptures<mode, WHITE>(enemies, friends) : generateCaptures<mode, BLACK>(enemies, friends);
+    }
+
+    template<_TgenMode mode, int side>
     void generateMoves(const u64 allpieces) {
+        generateMoves<mode, side>(gen_list[listId], allpieces);
+    }
+
+    template<_TgenMode mode, int side>
+    bool generateCaptures(const u64 enemies, const u64 friends) {
+        return generateCaptures<mode, side>(gen_list[listId], enemies, friends);
+    }
+
+    /// quiet moves into list, generateCaptures<side> must have set the legality masks first
+    template<_TgenMode mode, int side>
+    void generateMoves(_TmoveP &list, const u64 allpieces) {
         ASSERT_RANGE(side, 0, 1);
         ASSERT(chessboard[KING_BLACK]);
         ASSERT(chessboard[KING_WHITE]);
-        tryAllCastle(side, allpieces);
-        performDiagShift(BISHOP_BLACK + side, side, allpieces);
-        performRankFileShift(ROOK_BLACK + side, side, allpieces);
-        performRankFileShift(QUEEN_BLACK + side, side, allpieces);
-        performDiagShift(QUEEN_BLACK + side, side, allpieces);
-        performPawnShift<side>(~allpieces);
-        performKnightShiftCapture(KNIGHT_BLACK + side, ~allpieces, side);
-        performKingShiftCapture(side, ~allpieces);
+        if (evasionMask) {
+            if (!isInCheck) {
+                tryAllCastle<mode, side>(list, allpieces);
+            }
+            performDiagShift<mode, BISHOP_BLACK + side>(list, allpieces);
+            performRankFileShift<mode, ROOK_BLACK + side>(list, allpieces);
+            performRankFileShift<mode, QUEEN_BLACK + side>(list, allpieces);
+            performDiagShift<mode, QUEEN_BLACK + side>(list, allpieces);
+            performPawnShift<mode, side>(list, ~allpieces);
+            performKnightShiftCapture<mode, KNIGHT_BLACK + side>(list, ~allpieces & evasionMask);
+        }
+        performKingShiftCapture<mode, side>(list, ~allpieces);
     }
 
-    template<int side>
-    bool generateCaptures(const u64 enemies, const u64 friends) {
+    /// captures and promotions into list, true if the enemy king can be taken
+    template<_TgenMode mode, int side>
+    bool generateCaptures(_TmoveP &list, const u64 enemies, const u64 friends) {
         ASSERT_RANGE(side, 0, 1);
         ASSERT(chessboard[KING_BLACK]);
         ASSERT(chessboard[KING_WHITE]);
         const u64 allpieces = enemies | friends;
 
-        if (perftMode) {
-            int kingPosition = BITScanForward(chessboard[KING_BLACK + side]);
-            pinned = getPinned<side>(allpieces, friends, kingPosition);
-            isInCheck = isAttacked<side>(kingPosition, allpieces);
-        }
+        setLegalMask<side>(allpieces, friends);
+        /// the enemy king stays a target so that an illegal previous move is still reported
+        const u64 targets = enemies & (evasionMask | chessboard[KING_BLACK + (side ^ 1)]);
 
-        if (performPawnCapture<side>(enemies)) {
+        if (performPawnCapture<mode, side>(list, targets)) {
             return true;
         }
-        if (performKingShiftCapture(side, enemies)) {
+        if (performKingShiftCapture<mode, side>(list, enemies)) {
             return true;
         }
-        if (performKnightShiftCapture(KNIGHT_BLACK + side, enemies, side)) {
+        if (performKnightShiftCapture<mode, KNIGHT_BLACK + side>(list, targets)) {
             return true;
         }
-        if (performDiagCapture(BISHOP_BLACK + side, enemies, side, allpieces)) {
+        if (performDiagCapture<mode, BISHOP_BLACK + side>(list, targets, allpieces)) {
             return true;
         }
-        if (performRankFileCapture(ROOK_BLACK + side, enemies, side, allpieces)) {
+        if (performRankFileCapture<mode, ROOK_BLACK + side>(list, targets, allpieces)) {
             return true;
         }
-        if (performRankFileCapture(QUEEN_BLACK + side, enemies, side, allpieces)) {
+        if (performRankFileCapture<mode, QUEEN_BLACK + side>(list, targets, allpieces)) {
             return true;
         }
-        if (performDiagCapture(QUEEN_BLACK + side, enemies, side, allpieces)) {
+        if (performDiagCapture<mode, QUEEN_BLACK + side>(list, targets, allpieces)) {
             return true;
         }
         return false;
     }
 
-    bool getForceCheck() const {
-        return forceCheck;
-    }
-
-    void setForceCheck(bool b) const {
-        forceCheck = b;
+    /// pinned pieces, check state and the squares where a non king move must land (checker and the line to it)
+    template<int side>
+    void setLegalMask(const u64 allpieces, const u64 friends) {
+        const int kingPosition = BITScanForward(chessboard[KING_BLACK + side]);
+        pinned = getPinned<side>(allpieces, friends, kingPosition);
+        const u64 checkers = getAttackers<side, false>(kingPosition, allpieces);
+        isInCheck = checkers;
+        if (!checkers) {
+            evasionMask = 0xffffffffffffffffULL;
+        } else if (checkers & (checkers - 1)) {
+            evasionMask = 0;
+        } else {
+            evasionMask = checkers | TABLE(LINK_SQUARE)[kingPosition][BITScanForward(checkers)];
+        }
     }
 
     int getMoveFromSan(const string fenStr, _Tmove *move);
 
     void init();
 
-    int loadFen(string fen = "");
+    int loadFen(const string &fen = "");
 
     inline u64 getDiagCapture(const int position, const u64 allpieces, const u64 enemies) const {
         ASSERT_RANGE(position, 0, 63);
@@ -124,28 +170,75 @@ public:
 
     void setRepetitionMapCount(const int i);
 
+    int getRepetitionMapCount() const {
+        return repetitionMapCount;
+    }
+
     inline int getDiagShiftCount(const int position, const u64 allpieces) const {
         ASSERT_RANGE(position, 0, 63);
         return bitCount(Bitboard::getDiagonalAntiDiagonal(position, allpieces) & ~allpieces);
     }
 
-    bool performKingShiftCapture(const int side, const u64 enemies);
+    template<_TgenMode mode, int side>
+    bool performKingShiftCapture(_TmoveP &list, const u64 enemies) {
+        const int pos = BITScanForward(chessboard[KING_BLACK + side]);
+        ASSERT(pos != -1);
+        for (u64 x1 = enemies & TABLE(NEAR_MASK1)[pos]; x1; RESET_LSB(x1)) {
+            if (pushmove<mode, STANDARD_MOVE_MASK>(list, pos, BITScanForward(x1), side, NO_PROMOTION,
+                                                   KING_BLACK + side)) {
+                return true;
+            }
+        }
+        return false;
+    }
 
-    bool performKnightShiftCapture(const int piece, const u64 enemies, const int side);
+    template<_TgenMode mode, int piece>
+    bool performKnightShiftCapture(_TmoveP &list, const u64 enemies) {
+        for (u64 x = chessboard[piece]; x; RESET_LSB(x)) {
+            const int pos = BITScanForward(x);
+            for (u64 x1 = enemies & TABLE(KNIGHT_MASK)[pos]; x1; RESET_LSB(x1)) {
+                if (pushmove<mode, STANDARD_MOVE_MASK>(list, pos, BITScanForward(x1), piece & 1, NO_PROMOTION, piece)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
 
-    bool performDiagCapture(const int piece, const u64 enemies, const int side, const u64 allpieces);
+    template<_TgenMode mode, int piece>
+    bool performDiagCapture(_TmoveP &list, const u64 enemies, const u64 allpieces) {
+        for (u64 x2 = chessboard[piece]; x2; RESET_LSB(x2)) {
+            const int position = BITScanForward(x2);
+            for (u64 diag = getDiagonalAntiDiagonal(position, allpieces) & enemies; diag; RESET_LSB(diag)) {
+                if (pushmove<mode, STANDARD_MOVE_MASK>(list, position, BITScanForward(diag), piece & 1, NO_PROMOTION,
+                                                       piece)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
 
     u64 getTotMoves() const;
 
-    bool performRankFileCapture(const int piece, const u64 enemies, const int side, const u64 allpieces);
+    template<_TgenMode mode, int piece>
+    bool performRankFileCapture(_TmoveP &list, const u64 enemies, const u64 allpieces) {
+        for (u64 x2 = chessboard[piece]; x2; RESET_LSB(x2)) {
+            const int position = BITScanForward(x2);
+            for (u64 rankFile = getRankFile(position, allpieces) & enemies; rankFile; RESET_LSB(rankFile)) {
+                if (pushmove<mode, STANDARD_MOVE_MASK>(list, position, BITScanForward(rankFile), piece & 1,
+                                                       NO_PROMOTION, piece)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
 
-    template<int side>
-    bool performPawnCapture(const u64 enemies) {
+    template<_TgenMode mode, int side>
+    bool performPawnCapture(_TmoveP &list, const u64 enemies) {
         if (!chessboard[side]) {
-            if (chessboard[ENPASSANT_IDX] != NO_ENPASSANT) {
-                updateZobristKey(13, chessboard[ENPASSANT_IDX]);
-            }
-            chessboard[ENPASSANT_IDX] = NO_ENPASSANT;
+            clearEnpassant();
             return false;
         }
         constexpr int sh = side ? -7 : 7;
@@ -154,21 +247,21 @@ public:
         for (; x; RESET_LSB(x)) {
             const int o = BITScanForward(x);
             if ((side && o > 55) || (!side && o < 8)) {//PROMOTION
-                if (pushmove<PROMOTION_MOVE_MASK>(o + sh, o, side, QUEEN_BLACK + side, side)) {
+                if (pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh, o, side, QUEEN_BLACK + side, side)) {
                     return true;        //queen
                 }
-                if (perftMode) {
-                    if (pushmove<PROMOTION_MOVE_MASK>(o + sh, o, side, KNIGHT_BLACK + side, side)) {
+                if (allPromotions(mode)) {
+                    if (pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh, o, side, KNIGHT_BLACK + side, side)) {
                         return true;        //knight
                     }
-                    if (pushmove<PROMOTION_MOVE_MASK>(o + sh, o, side, ROOK_BLACK + side, side)) {
+                    if (pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh, o, side, ROOK_BLACK + side, side)) {
                         return true;        //rock
                     }
-                    if (pushmove<PROMOTION_MOVE_MASK>(o + sh, o, side, BISHOP_BLACK + side, side)) {
+                    if (pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh, o, side, BISHOP_BLACK + side, side)) {
                         return true;        //bishop
                     }
                 }
-            } else if (pushmove<STANDARD_MOVE_MASK>(o + sh, o, side, NO_PROMOTION, side)) {
+            } else if (pushmove<mode, STANDARD_MOVE_MASK>(list, o + sh, o, side, NO_PROMOTION, side)) {
                 return true;
             }
         }
@@ -178,30 +271,30 @@ public:
         for (; x; RESET_LSB(x)) {
             const int o = BITScanForward(x);
             if ((side && o > 55) || (!side && o < 8)) {    //PROMOTION
-                if (pushmove<PROMOTION_MOVE_MASK>(o + sh2, o, side, QUEEN_BLACK + side, side)) {
+                if (pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh2, o, side, QUEEN_BLACK + side, side)) {
                     return true;        //queen
                 }
-                if (perftMode) {
-                    if (pushmove<PROMOTION_MOVE_MASK>(o + sh2, o, side, KNIGHT_BLACK + side, side)) {
+                if (allPromotions(mode)) {
+                    if (pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh2, o, side, KNIGHT_BLACK + side, side)) {
                         return true;        //knight
                     }
-                    if (pushmove<PROMOTION_MOVE_MASK>(o + sh2, o, side, BISHOP_BLACK + side, side)) {
+                    if (pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh2, o, side, BISHOP_BLACK + side, side)) {
                         return true;        //bishop
                     }
-                    if (pushmove<PROMOTION_MOVE_MASK>(o + sh2, o, side, ROOK_BLACK + side, side)) {
+                    if (pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh2, o, side, ROOK_BLACK + side, side)) {
                         return true;        //rock
                     }
                 }
-            } else if (pushmove<STANDARD_MOVE_MASK>(o + sh2, o, side, NO_PROMOTION, side)) {
+            } else if (pushmove<mode, STANDARD_MOVE_MASK>(list, o + sh2, o, side, NO_PROMOTION, side)) {
                 return true;
             }
         }
         //ENPASSANT
         if (chessboard[ENPASSANT_IDX] != NO_ENPASSANT) {
-            x = ENPASSANT_MASK[side ^ 1][chessboard[ENPASSANT_IDX]] & chessboard[side];
+            x = TABLE(ENPASSANT_MASK)[side ^ 1][chessboard[ENPASSANT_IDX]] & chessboard[side];
             for (; x; RESET_LSB(x)) {
                 const int o = BITScanForward(x);
-                pushmove<ENPASSANT_MOVE_MASK>(o, (side ? chessboard[ENPASSANT_IDX] + 8 : chessboard[ENPASSANT_IDX] - 8),
+                pushmove<mode, ENPASSANT_MOVE_MASK>(list, o, (side ? chessboard[ENPASSANT_IDX] + 8 : chessboard[ENPASSANT_IDX] - 8),
                                               side, NO_PROMOTION, side);
 
             }
@@ -212,39 +305,61 @@ public:
     }
 
 
-    template<int side>
-    void performPawnShift(const u64 xallpieces) {
+    template<_TgenMode mode, int side>
+    void performPawnShift(_TmoveP &list, const u64 xallpieces) {
 
         u64 x = chessboard[side];
         if (x & PAWNS_JUMP[side]) {
-            checkJumpPawn<side>(x, xallpieces);
+            checkJumpPawn<mode, side>(list, x, xallpieces);
         }
         constexpr int sh = side ? -8 : 8;
         x = side ? x << 8 : x >> 8;
 
-        x &= xallpieces;
+        x &= xallpieces & evasionMask;
         for (; x; RESET_LSB(x)) {
             const int o = BITScanForward(x);
             ASSERT(getPieceAt(side, POW2[o + sh]) != SQUARE_FREE);
             ASSERT(getBitmap(side) & POW2[o + sh]);
             if (o > 55 || o < 8) {
-                pushmove<PROMOTION_MOVE_MASK>(o + sh, o, side, QUEEN_BLACK + side, side);
-                if (perftMode) {
-                    pushmove<PROMOTION_MOVE_MASK>(o + sh, o, side, KNIGHT_BLACK + side, side);
-                    pushmove<PROMOTION_MOVE_MASK>(o + sh, o, side, BISHOP_BLACK + side, side);
-                    pushmove<PROMOTION_MOVE_MASK>(o + sh, o, side, ROOK_BLACK + side, side);
+                pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh, o, side, QUEEN_BLACK + side, side);
+                if (allPromotions(mode)) {
+                    pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh, o, side, KNIGHT_BLACK + side, side);
+                    pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh, o, side, BISHOP_BLACK + side, side);
+                    pushmove<mode, PROMOTION_MOVE_MASK>(list, o + sh, o, side, ROOK_BLACK + side, side);
                 }
             } else {
-                pushmove<STANDARD_MOVE_MASK>(o + sh, o, side, NO_PROMOTION, side);
+                pushmove<mode, STANDARD_MOVE_MASK>(list, o + sh, o, side, NO_PROMOTION, side);
             }
         }
     }
 
     void clearHistoryHeuristic();
 
-    void performDiagShift(const int piece, const int side, const u64 allpieces);
+    /// keeps the ordering learnt on the previous move with less weight
+    void ageHistoryHeuristic();
 
-    void performRankFileShift(const int piece, const int side, const u64 allpieces);
+    template<_TgenMode mode, int piece>
+    void performDiagShift(_TmoveP &list, const u64 allpieces) {
+        for (u64 x2 = chessboard[piece]; x2; RESET_LSB(x2)) {
+            const int position = BITScanForward(x2);
+            u64 diag = getDiagonalAntiDiagonal(position, allpieces) & ~allpieces & evasionMask;
+            for (; diag; RESET_LSB(diag)) {
+                pushmove<mode, STANDARD_MOVE_MASK>(list, position, BITScanForward(diag), piece & 1, NO_PROMOTION, piece);
+            }
+        }
+    }
+
+    template<_TgenMode mode, int piece>
+    void performRankFileShift(_TmoveP &list, const u64 allpieces) {
+        for (u64 x2 = chessboard[piece]; x2; RESET_LSB(x2)) {
+            const int position = BITScanForward(x2);
+            u64 rankFile = getRankFile(position, allpieces) & ~allpieces & evasionMask;
+            for (; rankFile; RESET_LSB(rankFile)) {
+                pushmove<mode, STANDARD_MOVE_MASK>(list, position, BITScanForward(rankFile), piece & 1, NO_PROMOTION,
+                                                   piece);
+            }
+        }
+    }
 
     bool makemove(const _Tmove *move, const bool rep = true, const bool = false);
 
@@ -267,8 +382,20 @@ public:
         return gen_list[listId].size;
     }
 
+    _Tmove *getMove(const int i) const {
+        return &gen_list[listId].moveList[i];
+    }
+
     void pushStackMove() {
-        pushStackMove(chessboard[ZOBRISTKEY_IDX]);
+        pushStackMove(chessboard[ZOBRISTKEY_IDX], fiftyMoveCount);
+    }
+
+    int getFiftyMoveCount() const {
+        return fiftyMoveCount;
+    }
+
+    void setFiftyMoveCount(const int i) {
+        fiftyMoveCount = i;
     }
 
     void resetList() {
@@ -288,13 +415,18 @@ public:
 
     template<int side>
     u64 getPinned(const u64 allpieces, const u64 friends, const int kingPosition) const {
+        return getBlockers<side ^ 1>(allpieces, friends, kingPosition);
+    }
+
+    /// pieces in friends standing alone between a slider of xside and kingPosition
+    template<int xside>
+    u64 getBlockers(const u64 allpieces, const u64 friends, const int kingPosition) const {
         u64 result = 0;
-        const u64 *s = LINK_SQUARE[kingPosition];
-        constexpr int xside = side ^1;
-        u64 attacked = DIAGONAL_ANTIDIAGONAL[kingPosition] &
+        const u64 *s = TABLE(LINK_SQUARE)[kingPosition];
+        u64 attacked = TABLE(DIAGONAL_ANTIDIAGONAL)[kingPosition] &
             (chessboard[QUEEN_BLACK + xside] | chessboard[BISHOP_BLACK + xside]);
         attacked |=
-            RANK_FILE[kingPosition] & (chessboard[QUEEN_BLACK + xside] | chessboard[ROOK_BLACK + xside]);
+            TABLE(RANK_FILE)[kingPosition] & (chessboard[QUEEN_BLACK + xside] | chessboard[ROOK_BLACK + xside]);
         for (; attacked; RESET_LSB(attacked)) {
             const int pos = BITScanForward(attacked);
             const u64 b = *(s + pos) & allpieces;
@@ -309,27 +441,92 @@ public:
         return result;
     }
 
+    /// squares from which each piece of side would attack the enemy king, and the pieces of side uncovering a check
+    typedef struct {
+        u64 checkSquares[12];
+        u64 discovered;
+        int kingPosition;
+    } _TcheckInfo;
+
+    template<int side>
+    void getCheckInfo(_TcheckInfo &info, const u64 allpieces, const u64 friends) const {
+        const int kingPosition = BITScanForward(chessboard[KING_BLACK + (side ^ 1)]);
+        const u64 diag = Bitboard::getDiagonalAntiDiagonal(kingPosition, allpieces);
+        const u64 rankFile = Bitboard::getRankFile(kingPosition, allpieces);
+        info.kingPosition = kingPosition;
+        info.checkSquares[PAWN_BLACK + side] = TABLE(PAWN_FORK_MASK)[side ^ 1][kingPosition];
+        info.checkSquares[KNIGHT_BLACK + side] = TABLE(KNIGHT_MASK)[kingPosition];
+        info.checkSquares[BISHOP_BLACK + side] = diag;
+        info.checkSquares[ROOK_BLACK + side] = rankFile;
+        info.checkSquares[QUEEN_BLACK + side] = diag | rankFile;
+        info.checkSquares[KING_BLACK + side] = TABLE(NEAR_MASK1)[kingPosition];
+        info.discovered = getBlockers<side>(allpieces, friends, kingPosition);
+    }
+
+    /// true if move (of side) leaves the enemy king in check, castles and en passant are made and taken back
+    template<int side>
+    bool givesCheck(_Tmove *move, const _TcheckInfo &info) {
+        const uchar type = move->type & 0x3;
+        if (!type || type == ENPASSANT_MOVE_MASK) {
+            const u64 oldKey = chessboard[ZOBRISTKEY_IDX];
+            const u64 oldEnpassant = chessboard[ENPASSANT_IDX];
+            makemove(move, false, false);
+            const bool result = inCheck<side ^ 1>();
+            takeback(move, oldKey, false);
+            chessboard[ENPASSANT_IDX] = oldEnpassant;
+            return result;
+        }
+        const u64 to = POW2[move->to];
+        if ((info.discovered & POW2[move->from]) && !(TABLE(LINES)[move->from][info.kingPosition] & to)) {
+            return true;
+        }
+        if (type != PROMOTION_MOVE_MASK) {
+            return info.checkSquares[(uchar) move->pieceFrom] & to;
+        }
+        const u64 allpieces = getAllPieces() & NOTPOW2[move->from];
+        switch (move->promotionPiece) {
+            case KNIGHT_BLACK + side:
+                return TABLE(KNIGHT_MASK)[info.kingPosition] & to;
+            case BISHOP_BLACK + side:
+                return Bitboard::getDiagonalAntiDiagonal(info.kingPosition, allpieces) & to;
+            case ROOK_BLACK + side:
+                return Bitboard::getRankFile(info.kingPosition, allpieces) & to;
+            default:
+                return (Bitboard::getDiagonalAntiDiagonal(info.kingPosition, allpieces) |
+                    Bitboard::getRankFile(info.kingPosition, allpieces)) & to;
+        }
+    }
+
 #ifdef DEBUG_MODE
     unsigned nCutAB, nNullMoveCut, nCutFp, nCutRazor;
     double betaEfficiency;
 #endif
 protected:
     u64 pinned;
-    bool perftMode;
     int listId;
     _TmoveP *gen_list;
     static constexpr u64 RANK_2 = 0xff00ULL;
     static constexpr u64 RANK_3 = 0xff000000ULL;
     static constexpr u64 RANK_5 = 0xff00000000ULL;
     static constexpr u64 RANK_7 = 0xff000000000000ULL;
-    static constexpr uchar STANDARD_MOVE_MASK = 0x3;
-    static constexpr uchar ENPASSANT_MOVE_MASK = 0x1;
-    static constexpr uchar PROMOTION_MOVE_MASK = 0x2;
     static constexpr int MAX_REP_COUNT = 1024;
+    static constexpr int REPETITION_FILTER_MASK = 0x3ff;
     static constexpr int NO_PROMOTION = -1;
     int repetitionMapCount;
 
     u64 *repetitionMap;
+    int *fiftyMoveMap;
+#ifdef COPY_MAKE
+    /// -DCOPY_MAKE: makemove saves the whole board and takeback copies it back,
+    /// ring buffer so unmatched game moves just wrap
+    static constexpr unsigned BOARD_STACK_MASK = 255;
+    typedef struct {
+        _Tchessboard chessboard;
+        uchar mailbox[64];
+    } _TboardCopy;
+    _TboardCopy *boardStack;
+    unsigned boardStackIdx = 0;
+#endif
     int currentPly;
 
     u64 numMoves = 0;
@@ -352,8 +549,6 @@ protected:
 
     void pushRepetition(u64);
 
-    int historyHeuristic[64][64];
-
 #ifdef DEBUG_MODE
 
     template<int side, uchar type>
@@ -376,7 +571,7 @@ protected:
                 ASSERT(chessboard[KING_WHITE]);
 
                 result = isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]),
-                                          getBitmap<BLACK>() | getBitmap<WHITE>());
+                                          getBitmap<BLACK>(chessboard) | getBitmap<WHITE>(chessboard));
                 chessboard[pieceFrom] = from1;
                 if (pieceTo != SQUARE_FREE) {
                     chessboard[pieceTo] = to1;
@@ -396,7 +591,7 @@ protected:
                 }
                 chessboard[promotionPiece] = chessboard[promotionPiece] | POW2[to];
                 result = isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]),
-                                          getBitmap<BLACK>() | getBitmap<WHITE>());
+                                          getBitmap<BLACK>(chessboard) | getBitmap<WHITE>(chessboard));
                 if (pieceTo != SQUARE_FREE) {
                     chessboard[pieceTo] = to1;
                 }
@@ -415,7 +610,7 @@ protected:
                     chessboard[side ^ 1] &= NOTPOW2[to + 8];
                 }
                 result = isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]),
-                                          getBitmap<BLACK>() | getBitmap<WHITE>());
+                                          getBitmap<BLACK>(chessboard) | getBitmap<WHITE>(chessboard));
                 chessboard[side ^ 1] = to1;
                 chessboard[side] = from1;;
                 break;
@@ -429,102 +624,35 @@ protected:
 
 #endif
 
+    /// true if the move leaves the king of side attacked, uses the masks set by setLegalMask
     template<int side, uchar type>
     bool inCheck(const int from, const int to, const int pieceFrom, const int pieceTo, int promotionPiece) {
-#ifdef DEBUG_MODE
-        _Tchessboard a;
-        memcpy(&a, chessboard, sizeof(_Tchessboard));
-#endif
         ASSERT_RANGE(from, 0, 63);
         ASSERT_RANGE(to, 0, 63);
         ASSERT_RANGE(side, 0, 1);
         ASSERT_RANGE(pieceFrom, 0, 12);
         ASSERT_RANGE(pieceTo, 0, 12);
-        ASSERT(perftMode || forceCheck);
         ASSERT(!(type & 0xc));
-        if (perftMode) {
-
-            if ((KING_BLACK + side) != pieceFrom && !isInCheck) {
-                if (!(pinned & POW2[from]) || (LINES[from][to] & chessboard[KING_BLACK + side])) {
-                    ASSERT(!(inCheckSlow<side, type>(from, to, pieceFrom, pieceTo, promotionPiece)));
-                    return false;
-                } else {
-                    ASSERT ((inCheckSlow<side, type>(from, to, pieceFrom, pieceTo, promotionPiece)));
-                    return true;
-                }
-            }
-
-        }
-
-        bool result = 0;
-        switch (type & 0x3) {
-            case STANDARD_MOVE_MASK: {
-                u64 from1, to1 = -1;
-                ASSERT(pieceFrom != SQUARE_FREE);
-                ASSERT(pieceTo != KING_BLACK);
-                ASSERT(pieceTo != KING_WHITE);
-                from1 = chessboard[pieceFrom];
-                if (pieceTo != SQUARE_FREE) {
-                    to1 = chessboard[pieceTo];
-                    chessboard[pieceTo] &= NOTPOW2[to];
-                };
-                chessboard[pieceFrom] &= NOTPOW2[from];
-                chessboard[pieceFrom] |= POW2[to];
-                ASSERT(chessboard[KING_BLACK]);
-                ASSERT(chessboard[KING_WHITE]);
-
-                result = isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]),
-                                          getBitmap<BLACK>() | getBitmap<WHITE>());
-                chessboard[pieceFrom] = from1;
-                if (pieceTo != SQUARE_FREE) {
-                    chessboard[pieceTo] = to1;
-                };
-                break;
-            }
-            case PROMOTION_MOVE_MASK: {
-                u64 to1 = 0;
-                if (pieceTo != SQUARE_FREE) {
-                    to1 = chessboard[pieceTo];
-                }
-                u64 from1 = chessboard[pieceFrom];
-                u64 p1 = chessboard[promotionPiece];
-                chessboard[pieceFrom] &= NOTPOW2[from];
-                if (pieceTo != SQUARE_FREE) {
-                    chessboard[pieceTo] &= NOTPOW2[to];
-                }
-                chessboard[promotionPiece] = chessboard[promotionPiece] | POW2[to];
-                result = isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]),
-                                          getBitmap<BLACK>() | getBitmap<WHITE>());
-                if (pieceTo != SQUARE_FREE) {
-                    chessboard[pieceTo] = to1;
-                }
-                chessboard[pieceFrom] = from1;
-                chessboard[promotionPiece] = p1;
-                break;
-            }
-            case ENPASSANT_MOVE_MASK: {
-                u64 to1 = chessboard[side ^ 1];
-                u64 from1 = chessboard[side];
-                chessboard[side] &= NOTPOW2[from];
-                chessboard[side] |= POW2[to];
-                if (side) {
-                    chessboard[side ^ 1] &= NOTPOW2[to - 8];
-                } else {
-                    chessboard[side ^ 1] &= NOTPOW2[to + 8];
-                }
-                result = isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]),
-                                          getBitmap<BLACK>() | getBitmap<WHITE>());
-                chessboard[side ^ 1] = to1;
-                chessboard[side] = from1;;
-                break;
-            }
-            default:
-            _assert(0);
+        bool result;
+        if ((type & 0x3) == ENPASSANT_MOVE_MASK) {
+            /// the captured pawn leaves a square that may be on a line to the king
+            const u64 to1 = chessboard[side ^ 1];
+            const u64 from1 = chessboard[side];
+            chessboard[side] &= NOTPOW2[from];
+            chessboard[side] |= POW2[to];
+            const int capturedPos = side ? to - 8 : to + 8;
+            chessboard[side ^ 1] &= NOTPOW2[capturedPos];
+            result = isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]),
+                                      getBitmap<BLACK>(chessboard) | getBitmap<WHITE>(chessboard));
+            chessboard[side ^ 1] = to1;
+            chessboard[side] = from1;
+        } else if (pieceFrom == KING_BLACK + side) {
+            result = isAttacked<side>(to, getAllPieces() & NOTPOW2[from]);
+        } else {
+            ASSERT(POW2[to] & evasionMask);
+            result = (pinned & POW2[from]) && !(TABLE(LINES)[from][to] & chessboard[KING_BLACK + side]);
         }
-
-#ifdef DEBUG_MODE
-        ASSERT(!memcmp(&a, chessboard, sizeof(_Tchessboard)));
-#endif
+        ASSERT(result == (inCheckSlow<side, type>(from, to, pieceFrom, pieceTo, promotionPiece)));
         return result;
     }
 
@@ -532,24 +660,54 @@ protected:
 
     void unPerformCastle(const int side, const uchar type);
 
-    void tryAllCastle(const int side, const u64 allpieces);
+    template<_TgenMode mode, int side>
+    void tryAllCastle(_TmoveP &list, const u64 allpieces) {
+        if (side == WHITE) {
+            if (POW2_3 & chessboard[KING_WHITE] && !(allpieces & 0x6ULL) &&
+                chessboard[RIGHT_CASTLE_IDX] & RIGHT_KING_CASTLE_WHITE_MASK && chessboard[ROOK_WHITE] & POW2_0 &&
+                !isAttacked<WHITE>(1, allpieces) && !isAttacked<WHITE>(2, allpieces) &&
+                !isAttacked<WHITE>(3, allpieces)) {
+                pushmove<mode, KING_SIDE_CASTLE_MOVE_MASK>(list, -1, -1, WHITE, NO_PROMOTION, -1);
+            }
+            if (POW2_3 & chessboard[KING_WHITE] && !(allpieces & 0x70ULL) &&
+                chessboard[RIGHT_CASTLE_IDX] & RIGHT_QUEEN_CASTLE_WHITE_MASK && chessboard[ROOK_WHITE] & POW2_7 &&
+                !isAttacked<WHITE>(3, allpieces) && !isAttacked<WHITE>(4, allpieces) &&
+                !isAttacked<WHITE>(5, allpieces)) {
+                pushmove<mode, QUEEN_SIDE_CASTLE_MOVE_MASK>(list, -1, -1, WHITE, NO_PROMOTION, -1);
+            }
+        } else {
+            if (POW2_59 & chessboard[KING_BLACK] && chessboard[RIGHT_CASTLE_IDX] & RIGHT_KING_CASTLE_BLACK_MASK &&
+                !(allpieces & 0x600000000000000ULL) && chessboard[ROOK_BLACK] & POW2_56 &&
+                !isAttacked<BLACK>(57, allpieces) && !isAttacked<BLACK>(58, allpieces) &&
+                !isAttacked<BLACK>(59, allpieces)) {
+                pushmove<mode, KING_SIDE_CASTLE_MOVE_MASK>(list, -1, -1, BLACK, NO_PROMOTION, -1);
+            }
+            if (POW2_59 & chessboard[KING_BLACK] && chessboard[RIGHT_CASTLE_IDX] & RIGHT_QUEEN_CASTLE_BLACK_MASK &&
+                !(allpieces & 0x7000000000000000ULL) && chessboard[ROOK_BLACK] & POW2_63 &&
+                !isAttacked<BLACK>(59, allpieces) && !isAttacked<BLACK>(60, allpieces) &&
+                !isAttacked<BLACK>(61, allpieces)) {
+                pushmove<mode, QUEEN_SIDE_CASTLE_MOVE_MASK>(list, -1, -1, BLACK, NO_PROMOTION, -1);
+            }
+        }
+    }
 
 
-    template<uchar type>
-    bool pushmove(const int from, const int to, const int side, const int promotionPiece, const int pieceFrom) {
+    template<_TgenMode mode, uchar type>
+    bool pushmove(_TmoveP &list, const int from, const int to, const int side, const int promotionPiece, const int pieceFrom) {
         ASSERT(chessboard[KING_BLACK]);
         ASSERT(chessboard[KING_WHITE]);
         int piece_captured = SQUARE_FREE;
         bool res = false;
         if (((type & 0x3) != ENPASSANT_MOVE_MASK) && !(type & 0xc)) {
-            piece_captured = side ? getPieceAt<BLACK>(POW2[to]) : getPieceAt<WHITE>(POW2[to]);
+            piece_captured = mailbox[to];
+            ASSERT(piece_captured == (side ? getPieceAt<BLACK>(POW2[to]) : getPieceAt<WHITE>(POW2[to])));
             if (piece_captured == KING_BLACK + (side ^ 1)) {
                 res = true;
             }
         } else if (!(type & 0xc)) {//no castle
             piece_captured = side ^ 1;
         }
-        if (!(type & 0xc) && (forceCheck || perftMode)) {//no castle
+        if (!(type & 0xc) && !res) {//no castle
             if (side == WHITE && inCheck<WHITE, type>(from, to, pieceFrom, piece_captured, promotionPiece)) {
                 return false;
             }
@@ -557,47 +715,37 @@ protected:
                 return false;
             }
         }
-        _Tmove *mos;
-        ASSERT_RANGE(listId, 0, MAX_PLY - 1);
-
-        ASSERT(getListSize() < MAX_MOVE);
-        mos = &gen_list[listId].moveList[getListSize()];
-        ++gen_list[listId].size;
-        mos->type = (uchar) chessboard[RIGHT_CASTLE_IDX] | type;
-        mos->side = (char) side;
-        mos->capturedPiece = piece_captured;
+        ASSERT(list.size < MAX_MOVE);
+        const int idx = list.size++;
+        const unsigned moveType = (uchar) chessboard[RIGHT_CASTLE_IDX] | type;
         if (type & 0x3) {
-            mos->from = (uchar) from;
-            mos->to = (uchar) to;
-            mos->pieceFrom = pieceFrom;
-            mos->promotionPiece = (char) promotionPiece;
-            if (!perftMode) {
+            list.moveList[idx] = _Tmove::pack(from, to, pieceFrom, piece_captured, promotionPiece, moveType);
+            if (scoreMoves(mode)) {
                 if (res) {
-                    mos->score = _INFINITE;
+                    list.score[idx] = _INFINITE;
                 } else {
                     ASSERT_RANGE(pieceFrom, 0, 11);
                     ASSERT_RANGE(to, 0, 63);
                     ASSERT_RANGE(from, 0, 63);
-                    mos->score = historyHeuristic[from][to];
-                    mos->score += (PIECES_VALUE[piece_captured] >= PIECES_VALUE[pieceFrom]) ?
-                                  (PIECES_VALUE[piece_captured] - PIECES_VALUE[pieceFrom]) * 2
-                                                                                            : PIECES_VALUE[piece_captured];
-                    //mos->score += (MOV_ORD[pieceFrom][to] - MOV_ORD[pieceFrom][from]);
+                    list.score[idx] = historyHeuristic[from][to] +
+                                      ((PIECES_VALUE[piece_captured] >= PIECES_VALUE[pieceFrom]) ?
+                                       (PIECES_VALUE[piece_captured] - PIECES_VALUE[pieceFrom]) * 2
+                                                                                                : PIECES_VALUE[piece_captured]);
+                    //list.score[idx] += (MOV_ORD[pieceFrom][to] - MOV_ORD[pieceFrom][from]);
                 }
             }
         } else if (type & 0xc) {    //castle
             ASSERT(chessboard[RIGHT_CASTLE_IDX]);
-            mos->score = 100;
+            const int kingTo = type & KING_SIDE_CASTLE_MOVE_MASK ? (side ? G1 : G8) : (side ? C1 : C8);
+            list.moveList[idx] = _Tmove::pack(side ? E1 : E8, kingTo, KING_BLACK + side, SQUARE_FREE, 0, moveType);
+            if (scoreMoves(mode)) {
+                list.score[idx] = 100;
+            }
         }
-        mos->used = false;
-        ASSERT(getListSize() < MAX_MOVE);
+        ASSERT(list.size < MAX_MOVE);
         return res;
     }
 
-    _Tmove *getMove(const int i) const {
-        return &gen_list[listId].moveList[i];
-    }
-
     void setRunning(const int t) {
         running = t;
     }
@@ -608,7 +756,7 @@ protected:
 
     template<int side>
     bool inCheck() const {
-        return isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]), getBitmap<BLACK>() | getBitmap<WHITE>());
+        return isAttacked<side>(BITScanForward(chessboard[KING_BLACK + side]), getAllPieces());
     }
 
     void setHistoryHeuristic(const int from, const int to, const int value) {
@@ -621,22 +769,31 @@ protected:
 private:
     int running;
     bool isInCheck;
-    static bool forceCheck;
+    u64 evasionMask;
     static constexpr u64 TABJUMPPAWN = 0xFF00000000FF00ULL;
 
+    static constexpr bool allPromotions(const _TgenMode mode) {
+        return mode != SEARCH_MODE;
+    }
+
+    static constexpr bool scoreMoves(const _TgenMode mode) {
+        return mode == SEARCH_MODE;
+    }
+
     void writeRandomFen(const vector<int>);
 
-    template<int side>
-    void checkJumpPawn(u64 x, const u64 xallpieces) {
+    template<_TgenMode mode, int side>
+    void checkJumpPawn(_TmoveP &list, u64 x, const u64 xallpieces) {
         x &= TABJUMPPAWN;
         if (side) {
             x = (((x << 8) & xallpieces) << 8) & xallpieces;
         } else {
             x = (((x >> 8) & xallpieces) >> 8) & xallpieces;
         }
+        x &= evasionMask;
         for (; x; RESET_LSB(x)) {
             const int o = BITScanForward(x);
-            pushmove<STANDARD_MOVE_MASK>(o + (side ? -16 : 16), o, side, NO_PROMOTION, side);
+            pushmove<mode, STANDARD_MOVE_MASK>(list, o + (side ? -16 : 16), o, side, NO_PROMOTION, side);
         }
     }
 
@@ -644,13 +801,16 @@ private:
 
     void popStackMove() {
         ASSERT(repetitionMapCount > 0);
-        if (--repetitionMapCount && repetitionMap[repetitionMapCount - 1] == 0) {
-            repetitionMapCount--;
-        }
+        repetitionMapCount--;
+        ASSERT(repetitionFilter[repetitionMap[repetitionMapCount] & REPETITION_FILTER_MASK]);
+        repetitionFilter[repetitionMap[repetitionMapCount] & REPETITION_FILTER_MASK]--;
+        fiftyMoveCount = fiftyMoveMap[repetitionMapCount];
     }
 
-    void pushStackMove(const u64 key) {
+    void pushStackMove(const u64 key, const int oldFiftyMoveCount) {
         ASSERT(repetitionMapCount < MAX_REP_COUNT - 1);
+        repetitionFilter[key & REPETITION_FILTER_MASK]++;
+        fiftyMoveMap[repetitionMapCount] = oldFiftyMoveCount;
         repetitionMap[repetitionMapCount++] = key;
     }
 
@@ -660,13 +820,13 @@ private:
         ASSERT_RANGE(side, 0, 1);
 
         ///knight
-        u64 attackers = KNIGHT_MASK[position] & chessboard[KNIGHT_BLACK + (side ^ 1)];
+        u64 attackers = TABLE(KNIGHT_MASK)[position] & chessboard[KNIGHT_BLACK + (side ^ 1)];
         if (exitOnFirst && attackers)return attackers;
         ///king
-        attackers |= NEAR_MASK1[position] & chessboard[KING_BLACK + (side ^ 1)];
+        attackers |= TABLE(NEAR_MASK1)[position] & chessboard[KING_BLACK + (side ^ 1)];
         if (exitOnFirst && attackers)return attackers;
         ///pawn
-        attackers |= PAWN_FORK_MASK[side][position] & chessboard[PAWN_BLACK + (side ^ 1)];
+        attackers |= TABLE(PAWN_FORK_MASK)[side][position] & chessboard[PAWN_BLACK + (side ^ 1)];
         if (exitOnFirst && attackers)return attackers;
         ///bishop queen
         u64 enemies = chessboard[BISHOP_BLACK + (side ^ 1)] | chessboard[QUEEN_BLACK + (side ^ 1)];
@@ -686,5 +846,13 @@ private:
         return attackers;
     }
 
+protected:
+    /// the tables go after the scalars read on every node, which stay together on the first lines of the object
+
+    /// number of keys on the repetition stack for each value of the low key bits
+    unsigned short repetitionFilter[REPETITION_FILTER_MASK + 1];
+
+    int historyHeuristic[64][64];
+
 };
 
@@ -31,8 +31,9 @@ Hash::Hash() {
 }
 
 void Hash::clearAge() {
-    for (int i = 0; i < HASH_SIZE; i++) {
-        hashArray[HASH_ALWAYS][i].u.dataS.entryAge = 0;
+    // the age is part of the checked key, so it is never rewritten in place
+    if (!++generation) {
+        generation = 1;
     }
 }
 
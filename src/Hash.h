@@ -85,6 +85,7 @@ public:
 
     void clearHash();
 
+    /// starts a new search: entries of earlier searches stay readable and slowly lose their depth protection
     void clearAge();
 
     u64 readHash(const int type, const u64 zobristKeyR)
@@ -130,10 +131,11 @@ public:
             INC(collisions);
         }
 #endif
-        if (rootHashA->u.dataS.depth >= tmp.dataS.depth && rootHashA->u.dataS.entryAge) {
+        // an entry of an earlier search protects two plies less for each search since
+        if (rootHashA->u.dataS.depth - 2 * (uchar) (generation - rootHashA->u.dataS.entryAge) >= tmp.dataS.depth) {
             return;
         }
-        tmp.dataS.entryAge = 1;
+        tmp.dataS.entryAge = generation;
         rootHashA->key = (zobristKey ^ tmp.dataU);
         rootHashA->u.dataU = tmp.dataU;
 
@@ -142,6 +144,7 @@ public:
 private:
 
     int HASH_SIZE;
+    uchar generation = 1;
 #ifdef JS_MODE
     static constexpr int HASH_SIZE_DEFAULT = 1;
 #else
@@ -18,7 +18,7 @@
 
 #include "IterativeDeeping.h"
 
-IterativeDeeping::IterativeDeeping() : maxDepth(MAX_PLY), running(false), openBook(nullptr), ponderEnabled(false) {
+IterativeDeeping::IterativeDeeping() : maxDepth(MAX_PLY), mateMoves(0), running(false), openBook(nullptr), ponderEnabled(false) {
     setUseBook(false);
     SET(checkSmp2, 0);
 }
@@ -27,7 +27,12 @@ void IterativeDeeping::setMaxDepth(const int d) {
     maxDepth = min(d, _board::MAX_PLY);
 }
 
+void IterativeDeeping::setMateMoves(const int n) {
+    mateMoves = max(0, min(n, _board::MAX_PLY / 2 - 1));
+}
+
 IterativeDeeping::~IterativeDeeping() {
+    delete mateSearch;
 }
 
 void IterativeDeeping::enablePonder(const bool b) {
@@ -73,10 +78,21 @@ void IterativeDeeping::run() {
     searchManager.setRunning(2);
     searchManager.setRunningThread(true);
 
+    //proof-number mate search, falls back to alpha-beta if no mate is proved
+    if (mateMoves) {
+        if (searchMate()) {
+            ADD(checkSmp2, -1);
+            ASSERT(!checkSmp2);
+            LOCK_RELEASE(running);
+            return;
+        }
+        maxDepth = min(maxDepth, mateMoves * 2);
+    }
+
     //openbook
     if (openBook) {
         ASSERT(openBook);
-        string obMove = openBook->search(searchManager.boardToFen());
+        string obMove = openBook->search(searchManager.getChessboard());
         if (!obMove.empty()) {
             _Tmove move;
             searchManager.getMoveFromSan(obMove, &move);
@@ -101,14 +117,63 @@ void IterativeDeeping::run() {
 
     int mply = 0;
 
+    u64 nodeBudget = maxNodes;
+    if (searchManager.getDeterministic()) {
+        // same input, same tree: no state from earlier searches and no clock
+        searchManager.clearHash();
+        searchManager.setMaxTimeMillsec(0x7FFFFFFF);
+        if (!nodeBudget && maxDepth == MAX_PLY) {
+            nodeBudget = DETERMINISTIC_NODES;
+        }
+    }
+    u64 usedNodes = 0;
+
     searchManager.startClock();
-    searchManager.clearHistoryHeuristic();
+    if (searchManager.getDeterministic()) {
+        searchManager.clearHistoryHeuristic();
+    } else {
+        searchManager.ageHistoryHeuristic();
+    }
     searchManager.clearAge();
-    searchManager.setForceCheck(false);
+
+    // instant move: a forced move or a root already searched deeper than the last move's depth ends
+    // early, as does a stable best move. The time saved is banked and spent a quarter at a time
+    const bool fastPath = timeControl && !searchManager.getDeterministic();
+    int depthLimit = maxDepth;
+    if (fastPath) {
+        const int bonus = min(bankedTime / 4, searchManager.getMaxTimeMillsec());
+        bankedTime -= bonus;
+        searchManager.setMaxTimeMillsec(searchManager.getMaxTimeMillsec() + bonus);
+        if (searchManager.countLegalMoves() == 1) {
+            depthLimit = 1;
+        }
+    }
+    const int budget = searchManager.getMaxTimeMillsec();
+    bool earlyExit = false;
+    int completedDepth = 0;
+    int stableIterations = 0;
+    int previousScore = 0;
+    string previousBestmove;
+
+    // warm start: if the root was on the pv of the previous move the hash holds it with an exact score,
+    // start from its depth. The clock is checked from the first iteration, without a result start again from 1
+    int hashScore;
+    bool warmStart = false;
+    const int hashDepth = min(searchManager.getRootHashDepth(hashScore), depthLimit);
+    if (hashDepth > 1 && hashScore != INT_MAX) {
+        mply = hashDepth - 1;
+        searchManager.setValWindow(hashScore);
+        searchManager.setRunning(1);
+        warmStart = true;
+        if (fastPath && lastDepth && hashDepth >= lastDepth) {
+            depthLimit = hashDepth;
+        }
+    }
 
     auto start1 = std::chrono::high_resolution_clock::now();
     bool inMate = false;
-    int extension = 0;
+    // a mate score was already seen, one more iteration confirms it
+    bool forceCheck = false;
     string ponderMove;
     searchManager.init();
     int mateIn = INT_MAX;
@@ -122,24 +187,38 @@ void IterativeDeeping::run() {
         totMoves = 0;
         ++mply;
         searchManager.init();
+        if (nodeBudget) {
+            if (usedNodes >= nodeBudget) {
+                break;
+            }
+            searchManager.setMaxNodes(nodeBudget - usedNodes);
+        }
 
         searchManager.search(mply);
 
         searchManager.setRunningThread(1);
         searchManager.setRunning(1);
-        if (!searchManager.getRes(resultMove, ponderMove, pvv, &mateIn)) {
+        if (!searchManager.getRes(resultMove, sc, ponderMove, pvv, &mateIn)) {
+            if (warmStart) {
+                warmStart = false;
+                mply = 0;
+                searchManager.setRunning(2);
+                continue;
+            }
             debug("IterativeDeeping cmove == 0. Exit");
             break;
         }
+        warmStart = false;
+        completedDepth = mply;
 
         searchManager.incHistoryHeuristic(resultMove.from, resultMove.to, 0x800);
 
         auto end1 = std::chrono::high_resolution_clock::now();
         timeTaken = Time::diffTime(end1, start1) + 1;
         totMoves += searchManager.getTotMoves();
+        usedNodes += searchManager.getTotMoves();
 
-        sc = resultMove.score;
-        if (resultMove.score > _INFINITE - MAX_PLY) {
+        if (sc > _INFINITE - MAX_PLY) {
             sc = 0x7fffffff;
         }
 #ifdef DEBUG_MODE
@@ -191,59 +270,61 @@ void IterativeDeeping::run() {
         cout << "info string hash write collisions : " << collisions * 100 / totStoreHash << "%" << endl;
         cout << "info string hash read collisions : " << readCollisions * 100 / totStoreHash << "%" << endl;
 #endif
-        ///is a valid move?
-        bool trace = true;
-        if (abs(sc) > _INFINITE - MAX_PLY) {
-            const bool b = searchManager.getForceCheck();
-            const u64 oldKey = searchManager.getZobristKey(0);
-            searchManager.setForceCheck(true);
-            const bool valid = searchManager.makemove(&resultMove);
-            if (!valid) {
-                extension++;
-                trace = false;
+        resultMove.capturedPiece = searchManager.getPieceAt(resultMove.side() ^ 1, POW2[resultMove.to]);
+        bestmove = Search::decodeBoardinv(resultMove.type, resultMove.from, resultMove.side());
+        if (!(resultMove.type & (Search::KING_SIDE_CASTLE_MOVE_MASK | Search::QUEEN_SIDE_CASTLE_MOVE_MASK))) {
+            bestmove += Search::decodeBoardinv(resultMove.type, resultMove.to, resultMove.side());
+            if ((resultMove.type & 0x3) == Search::PROMOTION_MOVE_MASK) {
+                bestmove += tolower(FEN_PIECE[resultMove.promotionPiece]);
             }
-            searchManager.takeback(&resultMove, oldKey, true);
-            searchManager.setForceCheck(b);
         }
-        if (trace) {
-
-            resultMove.capturedPiece = searchManager.getPieceAt(resultMove.side ^ 1, POW2[resultMove.to]);
-            bestmove = Search::decodeBoardinv(resultMove.type, resultMove.from, resultMove.side);
-            if (!(resultMove.type & (Search::KING_SIDE_CASTLE_MOVE_MASK | Search::QUEEN_SIDE_CASTLE_MOVE_MASK))) {
-                bestmove += Search::decodeBoardinv(resultMove.type, resultMove.to, resultMove.side);
-                if (resultMove.promotionPiece != -1) {
-                    bestmove += tolower(FEN_PIECE[(uchar) resultMove.promotionPiece]);
-                }
-            }
 
-            if (abs(sc) > _INFINITE - MAX_PLY) {
-                cout << "info score mate 1 depth " << mply;
-            } else {
-                cout << "info score cp " << sc << " depth " << mply - extension;
-            }
-            cout << " nodes " << totMoves << " time " << timeTaken;
-            if (timeTaken)cout << " knps " << (totMoves / timeTaken);
-            cout << " pv " << pvv << endl;
+        if (abs(sc) > _INFINITE - MAX_PLY) {
+            cout << "info score mate 1 depth " << mply;
+        } else {
+            cout << "info score cp " << sc << " depth " << mply;
         }
+        cout << " nodes " << totMoves << " time " << timeTaken;
+        if (timeTaken)cout << " knps " << (totMoves / timeTaken);
+        cout << " pv " << pvv << endl;
 
-        if (searchManager.getForceCheck()) {
-            searchManager.setForceCheck(inMate);
+        if (forceCheck) {
+            forceCheck = inMate;
             searchManager.setRunning(1);
 
         } else if (abs(sc) > _INFINITE - MAX_PLY) {
-            searchManager.setForceCheck(true);
+            forceCheck = true;
             searchManager.setRunning(2);
 
         }
-        if (mply >= maxDepth + extension && (searchManager.getRunning(0) != 2 || inMate)) {
+        if (mply >= depthLimit && (searchManager.getRunning(0) != 2 || inMate)) {
+            earlyExit = depthLimit < maxDepth;
             break;
         }
+        if (fastPath && abs(sc) < _INFINITE - MAX_PLY) {
+            const bool stable = bestmove == previousBestmove && abs(sc - previousScore) <= STABLE_SCORE;
+            stableIterations = stable ? stableIterations + 1 : 0;
+            previousBestmove = bestmove;
+            previousScore = sc;
+            if (stableIterations >= STABLE_ITERATIONS && mply >= STABLE_DEPTH &&
+                timeTaken * STABLE_TIME_DIVISOR >= budget) {
+                earlyExit = true;
+                break;
+            }
+        }
 
         if (abs(sc) > _INFINITE - MAX_PLY) {
             inMate = true;
         }
     }
 
+    if (fastPath) {
+        if (earlyExit) {
+            bankedTime += max(0, budget - timeTaken);
+        }
+        lastDepth = completedDepth;
+    }
+
 #ifdef BENCH_MODE
 
     cout << "info string pawnTime eval avg: " << Eval::pawnTime.avgAndReset() << " ns." << endl;
@@ -253,9 +334,17 @@ void IterativeDeeping::run() {
     cout << "info string queenTime eval avg: " << Eval::queenTime.avgAndReset() << " ns." << endl;
     cout << "info string kingTime eval avg: " << Eval::kingTime.avgAndReset() << " ns." << endl;
     cout << "info string evalTime TOT avg: " << Eval::evalTime.avgAndReset() << " ns." << endl;
+    cout << "info string pawn hash hits: " << Eval::pawnHashHits * 100 / (1 + Eval::pawnHashProbes) << "% of " <<
+         Eval::pawnHashProbes << " probes" << endl;
+    Eval::pawnHashHits = Eval::pawnHashProbes = 0;
+    cout << "info string eval hash hits: " << Eval::evalHashHits * 100 / (1 + Eval::evalHashProbes) << "% of " <<
+         Eval::evalHashProbes << " probes" << endl;
+    Eval::evalHashHits = Eval::evalHashProbes = 0;
+    TableStats::printAndReset();
 
 #endif
 
+    searchManager.setMaxNodes(0);
     cout << "bestmove " << bestmove;
     if (ponderEnabled && ponderMove.size()) {
         cout << " ponder " << ponderMove;
@@ -267,6 +356,27 @@ void IterativeDeeping::run() {
     LOCK_RELEASE(running);
 }
 
+bool IterativeDeeping::searchMate() {
+    if (!mateSearch) {
+        mateSearch = new MateSearch();
+    }
+    mateSearch->setMaxTimeMillsec(searchManager.getMaxTimeMillsec());
+    mateSearch->setRunningCheck([this]() { return searchManager.getRunning(0) != 0; });
+    auto start = std::chrono::high_resolution_clock::now();
+    const int n = mateSearch->search(searchManager.boardToFen(), mateMoves);
+    const int timeTaken = Time::diffTime(std::chrono::high_resolution_clock::now(), start) + 1;
+    if (!n) {
+        cout << "info string no mate in " << mateMoves << " found, nodes " << mateSearch->getNodes() << " time "
+            << timeTaken << endl;
+        return false;
+    }
+    bestmove = mateSearch->getBestmove();
+    cout << "info score mate " << n << " depth " << n * 2 - 1 << " nodes " << mateSearch->getNodes() << " time "
+        << timeTaken << " knps " << (mateSearch->getNodes() / timeTaken) << " pv " << mateSearch->getPv() << endl;
+    cout << "bestmove " << bestmove << endl;
+    return true;
+}
+
 int IterativeDeeping::loadFen(const string fen) {
     return searchManager.loadFen(fen);
 }
@@ -24,6 +24,7 @@
 #include "SearchManager.h"
 #include "threadPool/Thread.h"
 #include "db/OpenBook.h"
+#include "mate/MateSearch.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -53,6 +54,22 @@ public:
 
     void setMaxDepth(const int);
 
+    void setMateMoves(const int);
+
+    void setMaxNodes(const u64 n) {
+        maxNodes = n;
+    }
+
+    /// the time comes from the clock (no depth, nodes, movetime, infinite or ponder): moves can end early
+    void setTimeControl(const bool b) {
+        timeControl = b;
+    }
+
+    void clearTimeBank() {
+        bankedTime = 0;
+        lastDepth = 0;
+    }
+
     void loadBook(const string);
 
     bool setParameter(String param, int value);
@@ -78,11 +95,29 @@ private:
 #endif
     SearchManager &searchManager = Singleton<SearchManager>::getInstance();
     int maxDepth;
+    int mateMoves;
+    u64 maxNodes = 0;
+    bool timeControl = false;
+    int bankedTime = 0;
+    int lastDepth = 0;
     string bestmove;
+    MateSearch *mateSearch = nullptr;
 
     volatile long running;
     OpenBook *openBook = nullptr;
     bool ponderEnabled;
 
+    bool searchMate();
+
+    /// node budget of a deterministic search without "nodes" or "depth"
+    STATIC_CONST u64 DETERMINISTIC_NODES = 1000000;
+
+    /// a best move unchanged for STABLE_ITERATIONS iterations from STABLE_DEPTH ends the search
+    /// once 1/STABLE_TIME_DIVISOR of the time is used
+    STATIC_CONST int STABLE_ITERATIONS = 4;
+    STATIC_CONST int STABLE_DEPTH = 8;
+    STATIC_CONST int STABLE_TIME_DIVISOR = 5;
+    STATIC_CONST int STABLE_SCORE = 15;
+
 };
 
@@ -22,12 +22,18 @@
 #include "db/bitbase/kpk.h"
 #include "namespaces/board.h"
 
-bool volatile Search::runningThread;
+_TcacheLine<volatile bool> Search::runningThread;
+_TcacheLine<bool> Search::useMtdf = {false};
 high_resolution_clock::time_point Search::startTime;
 using namespace _bitbase;
 void Search::run() {
     if (getRunning()) {
-        if (searchMovesVector.size())
+        if (useMtdf.value) {
+            if (searchMovesVector.size())
+                mtdf<true>(mainDepth, valWindow);
+            else
+                mtdf<false>(mainDepth, valWindow);
+        } else if (searchMovesVector.size())
             aspirationWindow<true>(mainDepth, valWindow);
         else
             aspirationWindow<false>(mainDepth, valWindow);
@@ -39,7 +45,7 @@ void Search::aspirationWindow(const int depth, const int valWin) {
     valWindow = valWin;
     init();
 
-    if (depth == 1) {
+    if (depth == 1 || abs(valWindow) > _INFINITE) {
         valWindow = search<searchMoves>(depth, -_INFINITE - 1, _INFINITE + 1);
     } else {
         int tmp = search<searchMoves>(mainDepth, valWindow - VAL_WINDOW, valWindow + VAL_WINDOW);
@@ -69,6 +75,40 @@ void Search::aspirationWindow(const int depth, const int valWin) {
     }
 }
 
+/**
+ * MTD(f): zero-window searches around the previous score until the bounds meet, then a narrow
+ * search to collect the pv. Falls back to the bounds left after MTDF_MAX_PASSES passes.
+ */
+template<bool searchMoves>
+void Search::mtdf(const int depth, const int firstGuess) {
+    valWindow = firstGuess;
+    init();
+
+    if (depth == 1 || abs(firstGuess) > _INFINITE) {
+        valWindow = search<searchMoves>(depth, -_INFINITE - 1, _INFINITE + 1);
+        return;
+    }
+    int g = firstGuess;
+    int lower = -_INFINITE - 1;
+    int upper = _INFINITE + 1;
+    for (int pass = 0; lower < upper && pass < MTDF_MAX_PASSES && getRunning(); pass++) {
+        const int beta = g == lower ? g + 1 : g;
+        g = search<searchMoves>(depth, beta - 1, beta);
+        if (g < beta) {
+            upper = g;
+        } else {
+            lower = g;
+        }
+    }
+    int tmp = lower < upper ? search<searchMoves>(depth, lower, upper) : search<searchMoves>(depth, g - 1, g + 1);
+    if (!pvLine.cmove) {
+        tmp = search<searchMoves>(depth, -_INFINITE - 1, _INFINITE + 1);
+    }
+    if (getRunning()) {
+        valWindow = tmp;
+    }
+}
+
 Search::Search() : ponder(false), nullSearch(false) {
 #ifdef DEBUG_MODE
     lazyEvalCuts = cumulativeMovesCount = totGen = 0;
@@ -78,29 +118,25 @@ Search::Search() : ponder(false), nullSearch(false) {
 
 void Search::clone(const Search *s) {
     memcpy(chessboard, s->chessboard, sizeof(_Tchessboard));
+    memcpy(mailbox, s->mailbox, sizeof(mailbox));
 }
 
 #ifndef JS_MODE
 void Search::printDtmGtb() {
     int side = getSide();
-    u64 friends = side == WHITE ? getBitmap<WHITE>() : getBitmap<BLACK>();
-    u64 enemies = side == BLACK ? getBitmap<WHITE>() : getBitmap<BLACK>();
     display();
     cout << "current: ";
     SearchManager::getGtb()->getDtm(side, true, chessboard, 100);
     fflush(stdout);
-    incListId();
-    generateCaptures(side, enemies, friends);
-    generateMoves(side, friends | enemies);
+    _TmoveBuffer moves;
+    const int n = generateLegalMoves(moves);
+    clearEnpassant();
     _Tmove *move;
-    u64 oldKey = 0;
+    const u64 oldKey = chessboard[ZOBRISTKEY_IDX];
 
-    for (int i = 0; i < getListSize(); i++) {
-        move = &gen_list[listId].moveList[i];
-        if (!makemove(move, false, true)) {
-            takeback(move, oldKey, false);
-            continue;
-        };
+    for (int i = 0; i < n; i++) {
+        move = &moves.moveList[i];
+        makemove(move, false);
 
         cout << endl << decodeBoardinv(move->type, move->from, getSide())
             << decodeBoardinv(move->type, move->to, getSide()) << " ";
@@ -116,9 +152,6 @@ void Search::printDtmGtb() {
     }
 
     cout << endl;
-
-    decListId();
-
 }
 #endif
 
@@ -150,13 +183,15 @@ Search::~Search() {
 }
 
 template<int side>
-int Search::quiescence(int alpha, int beta, const char promotionPiece, int N_PIECE, int depth) {
+HOT_KERNEL int Search::quiescence(int alpha, int beta, const char promotionPiece, int depth) {
     if (!getRunning()) {
         return 0;
     }
+    ++numMovesq;
+    checkNodes();
 
     const u64 zobristKeyR = chessboard[ZOBRISTKEY_IDX] ^_random::RANDSIDE[side];
-    int score = getScore(zobristKeyR, side, N_PIECE, alpha, beta, false);
+    int score = getScore(zobristKeyR, side, alpha, beta, false);
     if (score >= beta) {
         return beta;
     }
@@ -189,7 +224,7 @@ int Search::quiescence(int alpha, int beta, const char promotionPiece, int N_PIE
 
     u64 friends = getBitmap<side>();
     u64 enemies = getBitmap<side ^ 1>();
-    if (generateCaptures<side>(enemies, friends)) {
+    if (generateCaptures<SEARCH_MODE, side>(enemies, friends)) {
         decListId();
 
         return _INFINITE - (mainDepth + depth);
@@ -208,10 +243,8 @@ int Search::quiescence(int alpha, int beta, const char promotionPiece, int N_PIE
     }
 
     while ((move = getNextMove(&gen_list[listId]))) {
-        if (!makemove(move, false, true)) {
-            takeback(move, oldKey, false);
-            continue;
-        }
+        makemove(move, false);
+        ASSERT(!inCheck<side>());
 /**************Delta Pruning ****************/
         if (fprune && ((move->type & 0x3) != PROMOTION_MOVE_MASK) &&
             fscore + PIECES_VALUE[move->capturedPiece] <= alpha) {
@@ -220,7 +253,8 @@ int Search::quiescence(int alpha, int beta, const char promotionPiece, int N_PIE
             continue;
         }
 /************ end Delta Pruning *************/
-        int val = -quiescence<side ^ 1>(-beta, -alpha, move->promotionPiece, N_PIECE - 1, depth - 1);
+        const char promotionPiece = (move->type & 0x3) == PROMOTION_MOVE_MASK ? move->promotionPiece : NO_PROMOTION;
+        int val = -quiescence<side ^ 1>(-beta, -alpha, promotionPiece, depth - 1);
         score = max(score, val);
         takeback(move, oldKey, false);
         if (score > alpha) {
@@ -258,7 +292,7 @@ void Search::setRunning(int r) {
 }
 
 int Search::getRunning() {
-    if (!runningThread)return 0;
+    if (!runningThread.value)return 0;
     return GenMoves::getRunning();
 
 }
@@ -277,56 +311,26 @@ void Search::sortFromHash(const int listId, const Hash::_ThashData &phashe) {
         ASSERT_RANGE(phashe.dataS.from, 0, 63);
         ASSERT_RANGE(phashe.dataS.to, 0, 63);
         if (phashe.dataS.from == mos->from && phashe.dataS.to == mos->to) {
-            mos->score = _INFINITE / 2;
+            gen_list[listId].score[r] = _INFINITE / 2;
             return;
         }
     }
 }
 
-bool Search::checkInsufficientMaterial(int nPieces) {
-    //regexp: KN?B*KB*
-    switch (nPieces) {
-        case 2 :
-            //KK
-            return true;
-        case 3:
-            //KBK
-            if (chessboard[BISHOP_BLACK] || chessboard[BISHOP_WHITE])return true;
-            //KNK
-            if (chessboard[KNIGHT_BLACK] || chessboard[KNIGHT_WHITE])return true;
-            break;
-        case 4 :
-            //KBKB
-            if (chessboard[BISHOP_BLACK] && chessboard[BISHOP_WHITE])return true;
-            //KNKN
-            if (chessboard[KNIGHT_BLACK] && chessboard[KNIGHT_WHITE])return true;
-            //KBKN
-            if (chessboard[BISHOP_BLACK] && chessboard[KNIGHT_WHITE])return true;
-            if (chessboard[BISHOP_WHITE] && chessboard[KNIGHT_BLACK])return true;
-            //KNNK
-            if (bitCount(chessboard[KNIGHT_BLACK]) == 2)return true;
-            if (bitCount(chessboard[KNIGHT_WHITE]) == 2)return true;
-            break;
-        default:
-            return false;
+bool Search::checkDraw(const u64 key) {
+    //fifty-move rule
+    if (fiftyMoveCount >= 100) {
+        return true;
     }
-    return false;
-}
 
-bool Search::checkDraw(u64 key) {
+    //Threefold repetition, the key needs at least three entries on the stack
+    if (repetitionFilter[key & REPETITION_FILTER_MASK] < 3) {
+        return false;
+    }
+    // only positions since the last irreversible move with the same side to move
+    const int last = max(0, repetitionMapCount - 1 - fiftyMoveCount);
     int o = 0;
-    int count = 0;
-    for (int i = repetitionMapCount - 1; i >= 0; i--) {
-        if (repetitionMap[i] == 0) {
-            return false;
-        }
-
-        //fifty-move rule
-        if (++count > 100) {
-            return true;
-        }
-
-        //Threefold repetition
+    for (int i = repetitionMapCount - 1; i >= last; i -= 2) {
         if (repetitionMap[i] == key && ++o > 2) {
             return true;
         }
@@ -334,6 +338,27 @@ bool Search::checkDraw(u64 key) {
     return false;
 }
 
+int Search::countLegalMoves() {
+    _TmoveBuffer moves;
+    return generateLegalMoves(moves);
+}
+
+/// depth of the root in the hash (0 if missing), score receives its exact score or INT_MAX
+int Search::getRootHashDepth(int &score) {
+    const u64 zobristKeyR = chessboard[ZOBRISTKEY_IDX] ^_random::RANDSIDE[getSide()];
+    int depth = 0;
+    score = INT_MAX;
+    for (int type = 0; type < 2; type++) {
+        Hash::_ThashData phashe;
+        if ((phashe.dataU = hash->readHash(type, zobristKeyR)) && phashe.dataS.depth > depth) {
+            depth = phashe.dataS.depth;
+            const bool exact = phashe.dataS.flags == Hash::hashfEXACT && abs(phashe.dataS.score) < _INFINITE - MAX_PLY;
+            score = exact ? phashe.dataS.score : INT_MAX;
+        }
+    }
+    return depth;
+}
+
 void Search::setMainParam(const int depth) {
     memset(&pvLine, 0, sizeof(_TpvLine));
     mainDepth = depth;
@@ -342,51 +367,36 @@ void Search::setMainParam(const int depth) {
 template<bool searchMoves>
 int Search::search(const int depth, const int alpha, const int beta) {
     ASSERT_RANGE(depth, 0, MAX_PLY);
-    incListId();
-    const int side = getSide();
-    const u64 friends = (side == WHITE) ? getBitmap<WHITE>() : getBitmap<BLACK>();
-    const u64 enemies = (side == WHITE) ? getBitmap<BLACK>() : getBitmap<WHITE>();
-    generateCaptures(side, enemies, friends);
-    generateMoves(side, friends | enemies);
-    int n_root_moves = getListSize();
-    decListId();
+    _TmoveBuffer moves;
+    const int n_root_moves = generateLegalMoves(moves);
     return getSide() ? search<WHITE, searchMoves>(depth,
                                                   alpha,
                                                   beta,
                                                   &pvLine,
-                                                  bitCount(getBitmap<WHITE>() | getBitmap<BLACK>()),
                                                   &mainMateIn,
-                                                  n_root_moves)
-                     : search<BLACK, searchMoves>(depth, alpha, beta, &pvLine,
-                                                  bitCount(getBitmap<WHITE>() | getBitmap<BLACK>()), &mainMateIn,
-                                                  n_root_moves);
+                                                  n_root_moves,
+                                                  inCheck<WHITE>())
+                     : search<BLACK, searchMoves>(depth, alpha, beta, &pvLine, &mainMateIn,
+                                                  n_root_moves, inCheck<BLACK>());
 }
 
 string Search::probeRootTB() {
-    const auto tot = bitCount(getBitmap<WHITE>() | getBitmap<BLACK>());
+    const auto tot = bitCount(getAllPieces());
     const int side = getSide();
     string best = "";
 #ifndef JS_MODE
     if (SearchManager::getGtb() && SearchManager::getGtb()->isInstalledPieces(tot)) {
-        u64 friends = side == WHITE ? getBitmap<WHITE>() : getBitmap<BLACK>();
-        u64 enemies = side == BLACK ? getBitmap<WHITE>() : getBitmap<BLACK>();
-        //display();
-
-        incListId();
-        generateCaptures(side, enemies, friends);
-        generateMoves(side, friends | enemies);
-
-        u64 oldKey = 0;
+        _TmoveBuffer moves;
+        const int n = generateLegalMoves(moves);
+        clearEnpassant();
+        const u64 oldKey = chessboard[ZOBRISTKEY_IDX];
 
         int bestRes = INT_MAX;
         _Tmove *bestMove = nullptr;
         _Tmove *drawMove = nullptr;
-        for (int i = 0; i < getListSize(); i++) {
-            _Tmove *move = &gen_list[listId].moveList[i];
-            if (!makemove(move, false, true)) {
-                takeback(move, oldKey, false);
-                continue;
-            }
+        for (int i = 0; i < n; i++) {
+            _Tmove *move = &moves.moveList[i];
+            makemove(move, false);
 
             auto dtm = SearchManager::getGtb()->getDtm(side ^ 1, false, chessboard, 100);
 
@@ -420,8 +430,7 @@ string Search::probeRootTB() {
         ASSERT(bestMove != nullptr)
         best = string(decodeBoardinv(bestMove->type, bestMove->from, getSide())) +
             string(decodeBoardinv(bestMove->type, bestMove->to, getSide()));
-        if (bestMove->promotionPiece != -1)best += "q";
-        decListId();
+        if ((bestMove->type & 0x3) == PROMOTION_MOVE_MASK)best += tolower(FEN_PIECE[bestMove->promotionPiece]);
 
         return best;
     }
@@ -429,25 +438,17 @@ string Search::probeRootTB() {
 #endif
     //kpk -> try draw
     if (tot == 3 && chessboard[side] == 0 && chessboard[side ^ 1]) {
-
-        u64 friends = side == WHITE ? getBitmap<WHITE>() : getBitmap<BLACK>();
-        u64 enemies = side == BLACK ? getBitmap<WHITE>() : getBitmap<BLACK>();
-
-        incListId();
-        generateCaptures(side, enemies, friends);
-        generateMoves(side, friends | enemies);
-
-        u64 oldKey = 0;
+        _TmoveBuffer moves;
+        const int n = generateLegalMoves(moves);
+        clearEnpassant();
+        const u64 oldKey = chessboard[ZOBRISTKEY_IDX];
 
         _Tmove *bestMove = nullptr;
 
-        for (int i = 0; i < getListSize(); i++) {
+        for (int i = 0; i < n; i++) {
             if (bestMove)break;
-            _Tmove *move = &gen_list[listId].moveList[i];
-            if (!makemove(move, true, true)) {
-                takeback(move, oldKey, false);
-                continue;
-            }
+            _Tmove *move = &moves.moveList[i];
+            makemove(move, false);
 
             const int kw = BITScanForward(chessboard[KING_WHITE]);
             const int kb = BITScanForward(chessboard[KING_BLACK]);
@@ -470,8 +471,6 @@ string Search::probeRootTB() {
             best = string(decodeBoardinv(bestMove->type, bestMove->from, getSide())) +
                 string(decodeBoardinv(bestMove->type, bestMove->to, getSide()));
 
-        decListId();
-
         return best;
     }
     return "";
@@ -488,7 +487,8 @@ bool Search::checkSearchMoves(_Tmove *move) {
 }
 
 template<int side, bool checkMoves>
-int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE, int *mateIn, int n_root_moves) {
+HOT_KERNEL int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int *mateIn, int n_root_moves,
+                   const bool is_incheck_side) {
     ASSERT_RANGE(depth, 0, MAX_PLY);
     INC(cumulativeMovesCount);
 
@@ -508,9 +508,9 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
     ASSERT(chessboard[KING_WHITE]);
     ASSERT(chessboard[KING_BLACK + side]);
     int extension = 0;
-    const int is_incheck_side = inCheck<side>();
+    ASSERT(is_incheck_side == inCheck<side>());
     if (!is_incheck_side && depth != mainDepth) {
-        if (checkInsufficientMaterial(N_PIECE) || checkDraw(chessboard[ZOBRISTKEY_IDX])) {
+        if (isMaterialDraw(side) || checkDraw(chessboard[ZOBRISTKEY_IDX])) {
             if (inCheck<side ^ 1>()) {
                 return _INFINITE - (mainDepth - depth + 1);
             }
@@ -522,7 +522,7 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
     }
     depth += extension;
     if (depth == 0) {
-        return quiescence<side>(alpha, beta, -1, N_PIECE, 0);
+        return quiescence<side>(alpha, beta, -1, 0);
     }
 
     //************* hash ****************
@@ -543,11 +543,12 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
         setRunning(checkTime());
     }
     ++numMoves;
+    checkNodes();
     _TpvLine line;
     line.cmove = 0;
 
     // ********* null move ***********
-    if (!nullSearch && /*!pv_node &&*/  !is_incheck_side) {
+    if (!nullSearch && /*!pv_node &&*/  !is_incheck_side && (currentPly || !useMtdf.value)) {
         int n_depth = (n_root_moves > 17 || depth > 3) ? 1 : 3;
         if (n_depth == 3) {
             const u64 pieces = getPiecesNoKing<side>();
@@ -559,9 +560,9 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
             const int R = NULL_DEPTH + depth / NULL_DIVISOR;
             const int nullScore =
                 (depth - R - 1 > 0) ?
-                -search<side ^ 1, checkMoves>(depth - R - 1, -beta, -beta + 1, &line, N_PIECE, mateIn, n_root_moves)
+                -search<side ^ 1, checkMoves>(depth - R - 1, -beta, -beta + 1, &line, mateIn, n_root_moves, false)
                                     :
-                -quiescence<side ^ 1>(-beta, -beta + 1, -1, N_PIECE, 0);
+                -quiescence<side ^ 1>(-beta, -beta + 1, -1, 0);
             nullSearch = false;
             if (nullScore >= beta) {
                 INC(nNullMoveCut);
@@ -601,12 +602,12 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
     ASSERT_RANGE(KING_BLACK + (side ^ 1), 0, 11);
     const u64 friends = getBitmap<side>();
     const u64 enemies = getBitmap<side ^ 1>();
-    if (generateCaptures<side>(enemies, friends)) {
+    if (generateCaptures<SEARCH_MODE, side>(enemies, friends)) {
         decListId();
         score = _INFINITE - (mainDepth - depth + 1);
         return score;
     }
-    generateMoves<side>(friends | enemies);
+    generateMoves<SEARCH_MODE, side>(friends | enemies);
     int listcount = getListSize();
     if (!listcount) {
         --listId;
@@ -625,20 +626,19 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
     }
     INC(totGen);
     _Tmove *move;
-    bool checkInCheck = false;
     int countMove = 0;
     char hashf = Hash::hashfALPHA;
+    _TcheckInfo checkInfo;
+    getCheckInfo<side>(checkInfo, friends | enemies, friends);
     while ((move = getNextMove(&gen_list[listId]))) {
         if (!checkSearchMoves<checkMoves>(move) && depth == mainDepth)continue;
         countMove++;
         INC(betaEfficiencyCount);
-        if (!makemove(move, true, checkInCheck)) {
-            takeback(move, oldKey, true);
-            continue;
-        }
-        checkInCheck = true;
+        const bool givesCheckMove = givesCheck<side>(move, checkInfo);
+        makemove(move, true);
+        ASSERT(!inCheck<side>());
         if (futilPrune && ((move->type & 0x3) != PROMOTION_MOVE_MASK) &&
-            futilScore + PIECES_VALUE[move->capturedPiece] <= alpha && !inCheck<side>()) {
+            futilScore + PIECES_VALUE[move->capturedPiece] <= alpha) {
             INC(nCutFp);
             takeback(move, oldKey, true);
             continue;
@@ -646,9 +646,10 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
         //Late Move Reduction
         int val = INT_MAX;
         if (countMove > 4 && !is_incheck_side && depth >= 3 && move->capturedPiece == SQUARE_FREE &&
-            move->promotionPiece == NO_PROMOTION) {
+            (move->type & 0x3) != PROMOTION_MOVE_MASK) {
             currentPly++;
-            val = -search<side ^ 1, checkMoves>(depth - 2, -(alpha + 1), -alpha, &line, N_PIECE, mateIn, n_root_moves);
+            val = -search<side ^ 1, checkMoves>(depth - 2, -(alpha + 1), -alpha, &line, mateIn, n_root_moves,
+                                                givesCheckMove);
             ASSERT(val != INT_MAX);
             currentPly--;
         }
@@ -657,26 +658,21 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
             const int lwb = max(alpha, score);
             const int upb = (doMws ? (lwb + 1) : beta);
             currentPly++;
-            val = -search<side ^ 1, checkMoves>(depth - 1, -upb, -lwb, &line,
-                                                move->capturedPiece == SQUARE_FREE ? N_PIECE : N_PIECE - 1,
-                                                mateIn, n_root_moves);
+            val = -search<side ^ 1, checkMoves>(depth - 1, -upb, -lwb, &line, mateIn, n_root_moves, givesCheckMove);
             ASSERT(val != INT_MAX);
             currentPly--;
             if (doMws && (lwb < val) && (val < beta)) {
                 currentPly++;
-                val = -search<side ^ 1, checkMoves>(depth - 1, -beta, -val + 1,
-                                                    &line, move->capturedPiece == SQUARE_FREE ? N_PIECE : N_PIECE - 1,
-                                                    mateIn, n_root_moves);
+                val = -search<side ^ 1, checkMoves>(depth - 1, -beta, -val + 1, &line, mateIn, n_root_moves,
+                                                    givesCheckMove);
                 currentPly--;
             }
         }
         score = max(score, val);
         takeback(move, oldKey, true);
-        move->score = score;
         if (score > alpha) {
             if (score >= beta) {
                 decListId();
-                ASSERT(move->score == score);
                 INC(nCutAB);
                 ADD(betaEfficiency, betaEfficiencyCount / (double) listcount * 100.0);
                 if (getRunning()) {
@@ -692,8 +688,8 @@ int Search::search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE,
             alpha = score;
             hashf = Hash::hashfEXACT;
             best = move;
-            move->score = score;    //used in it
             updatePv(pline, &line, move);
+            pline->score = score;    //used in it
         }
     }
     if (getRunning()) {
@@ -718,6 +714,7 @@ _Tchessboard &Search::getChessboard() {
 
 void Search::setChessboard(_Tchessboard &b) {
     memcpy(chessboard, b, sizeof(chessboard));
+    initIncremental();
 }
 
 u64 Search::getZobristKey() {
@@ -27,10 +27,21 @@
 #include "threadPool/Thread.h"
 #include "db/GTB.h"
 
-class Search: public Eval, public Thread<Search> {
+class alignas(CACHE_LINE) Search: public Eval, public Thread<Search> {
 
 public:
 
+    /// each thread on its own cache lines, new ignores alignas before C++17
+    static void *operator new(size_t size) {
+        void *p = alignedMalloc(size);
+        _assert(p);
+        return p;
+    }
+
+    static void operator delete(void *p) {
+        alignedFree(p);
+    }
+
     typedef struct {
         Hash::_ThashData phasheType[2];
     } _TcheckHash;
@@ -47,10 +58,24 @@ public:
 
     void setPonder(bool);
 
+    bool getPonder() const {
+        return ponder;
+    }
+
+    int countLegalMoves();
+
     void setNullMove(bool);
 
+    static void setMtdf(bool b) {
+        useMtdf.value = b;
+    }
+
     void setMaxTimeMillsec(int);
 
+    void setMaxNodes(const u64 n) {
+        maxNodes = n;
+    }
+
     bool setParameter(String param, int value);
 
     int getMaxTimeMillsec();
@@ -80,19 +105,26 @@ public:
     STATIC_CONST int NULL_DIVISOR = 6;
     STATIC_CONST int NULL_DEPTH = 3;
     STATIC_CONST int VAL_WINDOW = 50;
+    STATIC_CONST int MTDF_MAX_PASSES = 24;
 
     void setRunningThread(bool t) {
-        runningThread = t;
+        runningThread.value = t;
     }
     string probeRootTB();
     bool getRunningThread() const {
-        return runningThread;
+        return runningThread.value;
     }
 
     int getValWindow() const {
         return valWindow;
     }
 
+    void setValWindow(const int v) {
+        valWindow = v;
+    }
+
+    int getRootHashDepth(int &score);
+
     void setChessboard(_Tchessboard &);
 
     _Tchessboard &getChessboard();
@@ -117,41 +149,54 @@ private:
 
     Hash *hash;
 
-    vector<int> searchMovesVector;
     int valWindow = INT_MAX;
-    static volatile bool runningThread;
-    _TpvLine pvLine;
+    static _TcacheLine<volatile bool> runningThread;
 
     bool ponder;
 
     template<bool searchMoves>
     void aspirationWindow(const int depth, const int valWindow);
 
+    template<bool searchMoves>
+    void mtdf(const int depth, const int firstGuess);
+
     int checkTime();
 
+    /// stops the search as soon as the node budget (search + quiescence nodes) is spent, 0 = unlimited
+    inline void checkNodes() {
+        if (maxNodes && numMoves + numMovesq >= maxNodes) {
+            setRunning(0);
+        }
+    }
+
     int maxTimeMillsec = 5000;
+    u64 maxNodes = 0;
     bool nullSearch;
+    static _TcacheLine<bool> useMtdf;
     static high_resolution_clock::time_point startTime;
 
-    bool checkDraw(u64);
+    bool checkDraw(const u64);
 
     template<int side, bool checkMoves>
-    int search(int depth, int alpha, int beta, _TpvLine *pline, int N_PIECE, int *mateIn, int n_root_moves);
+    int search(int depth, int alpha, int beta, _TpvLine *pline, int *mateIn, int n_root_moves,
+               const bool is_incheck_side);
 
     template<bool checkMoves>
     bool checkSearchMoves(_Tmove *move);
 
-    bool checkInsufficientMaterial(int);
-
     void sortFromHash(const int listId, const Hash::_ThashData &phashe);
 
     template<int side>
-    int quiescence(int alpha, int beta, const char promotionPiece, int, int depth);
+    int quiescence(int alpha, int beta, const char promotionPiece, int depth);
 
     void updatePv(_TpvLine *pline, const _TpvLine *line, const _Tmove *move);
 
     int mainMateIn;
     int mainDepth;
+
+    vector<int> searchMovesVector;
+    _TpvLine pvLine;
+
     inline pair<int, _TcheckHash> checkHash(const int type,
                                             const bool quies,
                                             const int alpha,
@@ -64,7 +64,7 @@ void SearchManager::search(const int mply) {
     ASSERT(bitCount(threadPool->getBitCount()) < 2);
     debug("start lazySMP --------------------------");
 
-    for (int ii = 1; ii < threadPool->getNthread(); ii++) {
+    for (int ii = 1; ii < threadPool->getNthread() && !deterministic; ii++) {
         Search &helperThread = threadPool->getNextThread();
         if (helperThread.getId() == 0)continue;
 
@@ -87,7 +87,7 @@ void SearchManager::search(const int mply) {
     debug("end singleSearch -------------------------------");
 }
 
-bool SearchManager::getRes(_Tmove &resultMove, string &ponderMove, string &pvv, int *mateIn1) {
+bool SearchManager::getRes(_Tmove &resultMove, int &score, string &ponderMove, string &pvv, int *mateIn1) {
     if (lineWin.cmove < 1) {
         return false;
     }
@@ -114,7 +114,8 @@ bool SearchManager::getRes(_Tmove &resultMove, string &ponderMove, string &pvv,
         }
         pvv.append(" ");
     }
-    memcpy(&resultMove, lineWin.argmove, sizeof(_Tmove));
+    resultMove = lineWin.argmove[0];
+    score = lineWin.score;
 
     return true;
 }
@@ -124,10 +125,13 @@ SearchManager::~SearchManager() {
 
 int SearchManager::loadFen(string fen) {
     int res = threadPool->getThread(0).loadFen(fen);
-
+    if (res == ChessBoard::FEN_ERROR) {
+        return res;
+    }
     ASSERT_RANGE(res, 0, 1);
     for (uchar i = 1; i < threadPool->getPool().size(); i++) {
         threadPool->getThread(i).setChessboard(threadPool->getThread(0).getChessboard());
+        threadPool->getThread(i).setFiftyMoveCount(threadPool->getThread(0).getFiftyMoveCount());
     }
     return res;
 }
@@ -178,26 +182,38 @@ string SearchManager::boardToFen() {
     return threadPool->getThread(0).boardToFen();
 }
 
+_Tchessboard &SearchManager::getChessboard() {
+    return threadPool->getThread(0).getChessboard();
+}
+
 void SearchManager::clearHistoryHeuristic() {
     for (Search *s:threadPool->getPool()) {
         s->clearHistoryHeuristic();
     }
 }
 
-void SearchManager::clearAge() {
-    hash.clearAge();
+void SearchManager::ageHistoryHeuristic() {
+    for (Search *s:threadPool->getPool()) {
+        s->ageHistoryHeuristic();
+    }
 }
 
-int SearchManager::getForceCheck() {
-    return threadPool->getThread(0).getForceCheck();
+int SearchManager::getRootHashDepth(int &score) {
+    return threadPool->getThread(0).getRootHashDepth(score);
 }
 
-u64 SearchManager::getZobristKey(int id) {
-    return threadPool->getThread(id).getZobristKey();
+void SearchManager::setValWindow(const int v) {
+    for (Search *s:threadPool->getPool()) {
+        s->setValWindow(v);
+    }
 }
 
-void SearchManager::setForceCheck(bool a) {
-    threadPool->getThread(0).setForceCheck(a);
+void SearchManager::clearAge() {
+    hash.clearAge();
+}
+
+u64 SearchManager::getZobristKey(int id) {
+    return threadPool->getThread(id).getZobristKey();
 }
 
 void SearchManager::setRunningThread(bool r) {
@@ -226,6 +242,13 @@ void SearchManager::setHashSize(int s) {
     hash.setHashSize(s);
 }
 
+void SearchManager::setEvalHashSize(int kb) {
+    evalHashSize = kb;
+    for (Search *s:threadPool->getPool()) {
+        s->setEvalHashSize(kb);
+    }
+}
+
 void SearchManager::setMaxTimeMillsec(int i) {
     for (Search *s:threadPool->getPool()) {
         s->setMaxTimeMillsec(i);
@@ -268,15 +291,14 @@ int SearchManager::getSide() {
 }
 
 int SearchManager::getScore(int side, const bool trace) {
-    int N_PIECE = 0;
-#ifdef DEBUG_MODE
-    N_PIECE = bitCount(threadPool->getThread(0).getBitmap<WHITE>() | threadPool->getThread(0).getBitmap<BLACK>());
-#endif
-    return threadPool->getThread(0).getScore(0xffffffffffffffffULL, side, N_PIECE, -_INFINITE, _INFINITE, trace);
+    return threadPool->getThread(0).getScore(0xffffffffffffffffULL, side, -_INFINITE, _INFINITE, trace);
 }
 
 void SearchManager::clearHash() {
     hash.clearHash();
+    for (Search *s:threadPool->getPool()) {
+        s->clearEvalHash();
+    }
 }
 
 int SearchManager::getMaxTimeMillsec() {
@@ -289,10 +311,27 @@ void SearchManager::setNullMove(bool i) {
     }
 }
 
+/// the budget only applies to the main thread, helpers stop with it
+void SearchManager::setMaxNodes(const u64 n) {
+    threadPool->getThread(0).setMaxNodes(n);
+}
+
+bool SearchManager::getPonder() {
+    return threadPool->getThread(0).getPonder();
+}
+
+int SearchManager::countLegalMoves() {
+    return threadPool->getThread(0).countLegalMoves();
+}
+
+void SearchManager::setMtdf(bool b) {
+    Search::setMtdf(b);
+}
+
 bool SearchManager::makemove(_Tmove *i) {
     bool b = false;
     for (Search *s:threadPool->getPool()) {
-        b = s->makemove(i);
+        b = s->makemove(i, true, true);
     }
     return b;
 }
@@ -353,11 +392,16 @@ void SearchManager::setRepetitionMapCount(int i) {
     }
 }
 
+int SearchManager::getRepetitionMapCount() {
+    return threadPool->getThread(0).getRepetitionMapCount();
+}
+
 
 bool SearchManager::setNthread(int nthread) {
     if (!threadPool->setNthread(nthread))return false;
     for (Search *s:threadPool->getPool()) {
         s->setHash(&hash);
+        s->setEvalHashSize(evalHashSize);
     }
     return true;
 }
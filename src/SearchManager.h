@@ -37,7 +37,7 @@ class SearchManager: public Singleton<SearchManager>
 
 public:
 
-    bool getRes(_Tmove &resultMove, string &ponderMove, string &pvv, int *mateIn);
+    bool getRes(_Tmove &resultMove, int &score, string &ponderMove, string &pvv, int *mateIn);
     static GTB *gtb;
 
     ~SearchManager();
@@ -64,17 +64,21 @@ public:
 
     string boardToFen();
 
+    _Tchessboard &getChessboard();
+
     bool setParameter(String param, int value);
 
     void clearHistoryHeuristic();
 
-    void clearAge();
+    void ageHistoryHeuristic();
 
-    int getForceCheck();
+    int getRootHashDepth(int &score);
 
-    u64 getZobristKey(int id);
+    void setValWindow(const int v);
+
+    void clearAge();
 
-    void setForceCheck(bool a);
+    u64 getZobristKey(int id);
 
     void setRunningThread(bool r);
 
@@ -89,11 +93,17 @@ public:
 
     void setHashSize(int s);
 
+    void setEvalHashSize(int kb);
+
     void setMaxTimeMillsec(int i);
     void unsetSearchMoves();
     void setSearchMoves(vector <string> &searchmoves);
     void setPonder(bool i);
 
+    bool getPonder();
+
+    int countLegalMoves();
+
     int getSide();
 
     int getScore(int side, const bool trace);
@@ -104,6 +114,19 @@ public:
 
     void setNullMove(bool i);
 
+    void setMtdf(bool b);
+
+    void setMaxNodes(const u64 n);
+
+    void setDeterministic(const bool b) {
+        deterministic = b;
+    }
+
+    bool getDeterministic() const {
+        return deterministic;
+    }
+
+    /// false if the move leaves its own king in check
     bool makemove(_Tmove *i);
 
     void takeback(_Tmove *move, const u64 oldkey, bool rep);
@@ -123,6 +146,8 @@ public:
 
     void setRepetitionMapCount(int i);
 
+    int getRepetitionMapCount();
+
     void deleteGtb();
 
     bool setNthread(int);
@@ -204,10 +229,13 @@ public:
 private:
 
     Hash hash;
+    /// of each thread, kb
+    int evalHashSize = Eval::EVAL_HASH_SIZE_DEFAULT;
     SearchManager();
     ThreadPool<Search> *threadPool = nullptr;
 
     int mateIn;
+    bool deterministic = false;
 
     _TpvLine lineWin;
 
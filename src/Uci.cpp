@@ -43,6 +43,16 @@ void Uci::getToken(istringstream &uip, String &token) {
     token.toLower();
 }
 
+void Uci::makeMoves(istringstream &uip) {
+    _Tmove move;
+    string token;
+    while (uip >> token) {
+        int x = !searchManager.getMoveFromSan(token, &move);
+        searchManager.setSide(x);
+        searchManager.makemove(&move);
+    }
+}
+
 void Uci::listner(IterativeDeeping *it) {
     string command;
     bool knowCommand;
@@ -116,7 +126,11 @@ void Uci::listner(IterativeDeeping *it) {
             cout << "id author Giuseppe Cannella" << endl;
             cout << "option name Hash type spin default 64 min 1 max 10000" << endl;
             cout << "option name Clear Hash type button" << endl;
+            cout << "option name EvalHashKB type spin default " << Eval::EVAL_HASH_SIZE_DEFAULT <<
+                 " min 1 max 1048576" << endl;
             cout << "option name Nullmove type check default true" << endl;
+            cout << "option name MTDf type check default false" << endl;
+            cout << "option name Deterministic type check default false" << endl;
             cout << "option name Book File type string default cinnamon.bin" << endl;
             cout << "option name OwnBook type check default " << _BOOLEAN[it->getUseBook()] << "" << endl;
             cout << "option name Ponder type check default " << _BOOLEAN[it->getPonderEnabled()] << "" << endl;
@@ -150,8 +164,11 @@ void Uci::listner(IterativeDeeping *it) {
             searchManager.setRunningThread(false);
         } else if (token == "ucinewgame") {
             while (it->getRunning());
+            positionCommand.clear();
             searchManager.loadFen();
             searchManager.clearHash();
+            searchManager.clearHistoryHeuristic();
+            it->clearTimeBank();
             knowCommand = true;
         } else if (token == "setvalue") {
             getToken(uip, token);
@@ -159,6 +176,8 @@ void Uci::listner(IterativeDeeping *it) {
             getToken(uip, value);
             knowCommand = searchManager.setParameter(token, stoi(value));
         } else if (token == "setoption") {
+            // threads and the hash may be rebuilt, the next position is replayed in full
+            positionCommand.clear();
             getToken(uip, token);
             if (token == "name") {
                 getToken(uip, token);
@@ -250,6 +269,13 @@ void Uci::listner(IterativeDeeping *it) {
                         searchManager.setHashSize(stoi(token));
                         knowCommand = true;
                     }
+                } else if (token == "evalhashkb") {
+                    getToken(uip, token);
+                    if (token == "value") {
+                        getToken(uip, token);
+                        searchManager.setEvalHashSize(stoi(token));
+                        knowCommand = true;
+                    }
                 } else if (token == "nullmove") {
                     getToken(uip, token);
                     if (token == "value") {
@@ -257,6 +283,20 @@ void Uci::listner(IterativeDeeping *it) {
                         knowCommand = true;
                         searchManager.setNullMove(token == "true");
                     }
+                } else if (token == "mtdf") {
+                    getToken(uip, token);
+                    if (token == "value") {
+                        getToken(uip, token);
+                        knowCommand = true;
+                        searchManager.setMtdf(token == "true");
+                    }
+                } else if (token == "deterministic") {
+                    getToken(uip, token);
+                    if (token == "value") {
+                        getToken(uip, token);
+                        knowCommand = true;
+                        searchManager.setDeterministic(token == "true");
+                    }
                 } else if (token == "ownbook") {
                     getToken(uip, token);
                     if (token == "value") {
@@ -292,37 +332,64 @@ void Uci::listner(IterativeDeeping *it) {
         } else if (token == "position") {
             while (it->getRunning());
             knowCommand = true;
-            searchManager.setRepetitionMapCount(0);
-            getToken(uip, token);
-            _Tmove move;
-            if (token == "startpos") {
-                it->setUseBook(it->getUseBook());
-                searchManager.loadFen();
-                getToken(uip, token);
+            while (!command.empty() && isspace(command.back())) {
+                command.pop_back();
             }
-            if (token == "fen") {
-                string fen;
-                while (token != "moves" && !uip.eof()) {
-                    uip >> token;
-                    fen.append(token);
-                    fen.append(" ");
-                };
-                searchManager.init();
-                int x = searchManager.loadFen(fen);
-                searchManager.setSide(x);
-                searchManager.pushStackMove();
+            // same game and the board is still where the last position command left it
+            const size_t len = positionCommand.size();
+            bool extend = len && command.size() > len && command[len] == ' ' &&
+                !command.compare(0, len, positionCommand) &&
+                searchManager.getRepetitionMapCount() == positionRepetitionCount &&
+                !memcmp(searchManager.getChessboard(), positionChessboard, sizeof(_Tchessboard));
+            istringstream tail;
+            if (extend) {
+                tail.str(command.substr(len));
+                if (positionCommand.find(" moves") == string::npos) {
+                    string moves;
+                    tail >> moves;
+                    extend = moves == "moves";
+                }
             }
-            if (token == "moves") {
-                while (!uip.eof()) {
-                    uip >> token;
-                    int x = !searchManager.getMoveFromSan(token, &move);
-                    searchManager.setSide(x);
-                    searchManager.makemove(&move);
+            if (extend) {
+                makeMoves(tail);
+            } else {
+                searchManager.setRepetitionMapCount(0);
+                getToken(uip, token);
+                if (token == "startpos") {
+                    it->setUseBook(it->getUseBook());
+                    searchManager.loadFen();
+                    getToken(uip, token);
+                }
+                if (token == "fen") {
+                    string fen;
+                    while (token != "moves" && !uip.eof()) {
+                        uip >> token;
+                        fen.append(token);
+                        fen.append(" ");
+                    };
+                    searchManager.init();
+                    int x = searchManager.loadFen(fen);
+                    if (x == ChessBoard::FEN_ERROR) {
+                        // keep the previous position and skip its moves
+                        cout << "info string bad fen " << fen << endl;
+                        token.clear();
+                        command.clear();
+                    } else {
+                        searchManager.setSide(x);
+                        searchManager.pushStackMove();
+                    }
+                }
+                if (token == "moves") {
+                    makeMoves(uip);
                 }
             }
-
+            positionCommand = command;
+            memcpy(positionChessboard, searchManager.getChessboard(), sizeof(_Tchessboard));
+            positionRepetitionCount = searchManager.getRepetitionMapCount();
         } else if (token == "go") {
             it->setMaxDepth(MAX_PLY);
+            it->setMateMoves(0);
+            it->setMaxNodes(0);
             searchManager.unsetSearchMoves();
             int wtime = 200000; //5 min
             int btime = 200000;
@@ -351,6 +418,22 @@ void Uci::listner(IterativeDeeping *it) {
                     }
                     it->setMaxDepth(depth);
                     forceTime = true;
+                } else if (token == "nodes") {
+                    u64 nodes;
+                    uip >> nodes;
+                    if (!setMovetime) {
+                        searchManager.setMaxTimeMillsec(0x7FFFFFFF);
+                    }
+                    it->setMaxNodes(nodes);
+                    forceTime = true;
+                } else if (token == "mate") {
+                    int mateMoves;
+                    uip >> mateMoves;
+                    if (!setMovetime) {
+                        searchManager.setMaxTimeMillsec(0x7FFFFFFF);
+                    }
+                    it->setMateMoves(mateMoves);
+                    forceTime = true;
                 } else if (token == "movetime") {
                     int tim;
                     uip >> tim;
@@ -391,6 +474,7 @@ void Uci::listner(IterativeDeeping *it) {
                 }
                 lastTime = searchManager.getMaxTimeMillsec();
             }
+            it->setTimeControl(!forceTime && !searchManager.getPonder());
             if (!uciMode) {
                 searchManager.display();
             }
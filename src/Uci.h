@@ -48,6 +48,14 @@ private:
 
     void startListner();
 
+    void makeMoves(istringstream &uip);
+
+    /// last position command and the board and repetition count it left, a position command that only
+    /// appends moves to it plays just the new ones
+    string positionCommand;
+    _Tchessboard positionChessboard;
+    int positionRepetitionCount = 0;
+
     bool runPerftAndExit = false;
 
 };
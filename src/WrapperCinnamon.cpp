@@ -31,6 +31,6 @@ unsigned WrapperCinnamon::perft(const string &fen, const int depth) {
 
 bool WrapperCinnamon::isValid(const string &fen) const {
     ChessBoard a;
-    if (a.loadFen(fen) == -1)return false;
+    if (a.loadFen(fen) == ChessBoard::FEN_ERROR)return false;
     return true;
 }
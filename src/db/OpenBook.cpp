@@ -40,91 +40,36 @@ OpenBook::~OpenBook() {
     dispose();
 }
 
-u64 OpenBook::createKey(string fen1) {
-    const char *fen = fen1.c_str();
-    u64 *RandomPiece = Random64;
-    u64 *RandomCastle = Random64 + 768;
-    u64 *RandomEnPassant = Random64 + 772;
-    u64 *RandomTurn = Random64 + 780;
-    static const char *piece_names = "pPnNbBrRqQkK";
-    char board_s[72 + 1];
-    char to_move_c;
-    char castle_flags_s[4 + 1];
-    char ep_square_s[2 + 1];
-    char board[8][8];
-    char c;
-    int r, f, i, p_enc;
-    unsigned p;
+u64 OpenBook::createKey(const _Tchessboard &chessboard) {
+    const u64 *RandomPiece = Random64;
+    const u64 *RandomCastle = Random64 + 768;
+    const u64 *RandomEnPassant = Random64 + 772;
+    const u64 *RandomTurn = Random64 + 780;
+    // polyglot piece order "pPnNbBrRqQkK" from the board order
+    static constexpr int POLYGLOT_PIECE[12] = {0, 1, 6, 7, 4, 5, 2, 3, 10, 11, 8, 9};
     u64 key = 0;
-    sscanf(fen, "%72s %c %4s %2s", board_s, &to_move_c, castle_flags_s, ep_square_s);
-    r = 7;
-    f = 0;
-    p = 0;
-    while (1) {
-        if (p >= strlen(board_s)) {
-            break;
-        }
-        c = board_s[p++];
-        if (c == '/') {
-            r--;
-            f = 0;
-            continue;
-        }
-        if (('1' <= c) && ('8' >= c)) {
-            for (i = 0; i <= c - '1'; i++) {
-                board[f++][r] = '-';
-            }
-            continue;
-        }
-        board[f++][r] = c;
-    }
-    for (f = 0; f <= 7; f++) {
-        for (r = 0; r <= 7; r++) {
-            c = board[f][r];
-            if (c != '-') {
-                p_enc = strchr(piece_names, c) - piece_names;
-                key ^= RandomPiece[64 * p_enc + 8 * r + f];
-            }
+    for (int piece = 0; piece < 12; piece++) {
+        for (u64 x = chessboard[piece]; x; RESET_LSB(x)) {
+            const int position = BITScanForward(x);
+            key ^= RandomPiece[64 * POLYGLOT_PIECE[piece] + (position & 0x38) + 7 - (position & 7)];
         }
     }
-    p = 0;
-    while (1) {
-        if (p >= strlen(castle_flags_s)) {
-            break;
-        }
-        c = castle_flags_s[p++];
-        switch (c) {
-            case '-':
-                break;
-            case 'K':
-                key ^= RandomCastle[0];
-                break;
-            case 'Q':
-                key ^= RandomCastle[1];
-                break;
-            case 'k':
-                key ^= RandomCastle[2];
-                break;
-            case 'q':
-                key ^= RandomCastle[3];
-                break;
-            default:
-                break;
-        }
-    }
-    if (ep_square_s[0] != '-') {
-        f = ep_square_s[0] - 'a';
-        if (to_move_c == 'b') {
-            if ((f > 0 && board[f - 1][3] == 'p') || (f < 7 && board[f + 1][3] == 'p')) {
-                key ^= RandomEnPassant[f];
-            }
-        } else {
-            if ((f > 0 && board[f - 1][4] == 'P') || (f < 7 && board[f + 1][4] == 'P')) {
-                key ^= RandomEnPassant[f];
-            }
+    const u64 castle = chessboard[RIGHT_CASTLE_IDX];
+    if (castle & ChessBoard::RIGHT_KING_CASTLE_WHITE_MASK) key ^= RandomCastle[0];
+    if (castle & ChessBoard::RIGHT_QUEEN_CASTLE_WHITE_MASK) key ^= RandomCastle[1];
+    if (castle & ChessBoard::RIGHT_KING_CASTLE_BLACK_MASK) key ^= RandomCastle[2];
+    if (castle & ChessBoard::RIGHT_QUEEN_CASTLE_BLACK_MASK) key ^= RandomCastle[3];
+    const int side = chessboard[SIDETOMOVE_IDX];
+    const u64 enpassant = chessboard[ENPASSANT_IDX];
+    if (enpassant != ChessBoard::NO_ENPASSANT) {
+        // only when a pawn of the side to move stands next to the pushed one
+        const int file = enpassant & 7;
+        const u64 pawns = chessboard[PAWN_BLACK + side];
+        if ((file < 7 && (pawns & POW2[enpassant + 1])) || (file > 0 && (pawns & POW2[enpassant - 1]))) {
+            key ^= RandomEnPassant[7 - file];
         }
     }
-    if (to_move_c == 'w') {
+    if (side == WHITE) {
         key ^= RandomTurn[0];
     }
     return key;
@@ -224,8 +169,8 @@ void OpenBook::moveToString(char move_s[6], const unsigned short move) {
     }
 }
 
-string OpenBook::search(string fen) {
-    u64 key = createKey(fen);
+string OpenBook::search(const _Tchessboard &chessboard) {
+    const u64 key = createKey(chessboard);
     entry_t entry;
     char move_s[6];
     findKey(key, &entry);
@@ -50,7 +50,7 @@ public:
     virtual ~OpenBook();
 
 
-    string search(string fen);
+    string search(const _Tchessboard &chessboard);
 
     void dispose();
 
@@ -66,7 +66,7 @@ private:
 
     FILE *openBookFile;
 
-    u64 createKey(string fen);
+    u64 createKey(const _Tchessboard &chessboard);
 
     int intFromFile(const int l, u64 *r);
 
@@ -42,7 +42,7 @@ unsigned perft(char *fen, int depth, int hashSize) {
 }
 int isvalid(char *fen) {
     ChessBoard c;
-    return c.loadFen(fen) == 2 ? 0 : 1;
+    return c.loadFen(fen) == ChessBoard::FEN_ERROR ? 0 : 1;
 }
 
 }//extern C
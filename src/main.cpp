@@ -56,6 +56,9 @@ void printHeader() {
 #endif
 #ifdef HAS_BSF
     cout << "bsf ";
+#endif
+#ifdef MULTI_TARGET
+    cout << "dispatch " << getCpuPath() << " ";
 #endif
     cout << "compiled " << __DATE__ << " with ";
 #if defined(__clang__)
@@ -90,7 +93,7 @@ void printHeader() {
 
 int main(int argc, char **argv) {
     ASSERT(sizeof(Hash::_Thash) == 16);
-    ASSERT(sizeof(_Tmove) == 16);
+    ASSERT(_Tmove::pack(1, 2, 3, 4, 5, 6).to == 2 && _Tmove::pack(1, 2, 3, 4, 5, 6).type == 6);
 
     printHeader();
 
@@ -0,0 +1,242 @@
+/*
+    Cinnamon UCI chess engine
+    Copyright (C) Giuseppe Cannella
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MateSearch.h"
+
+MateSearch::MateSearch() {
+}
+
+MateSearch::~MateSearch() {
+    free(hash);
+}
+
+void MateSearch::setHashSize(const int mb) {
+    free(hash);
+    hashSizeMb = max(1, mb);
+    u64 n = 1;
+    while (n * 2 * sizeof(_TmateHash) <= (u64) hashSizeMb * 1024 * 1024) {
+        n *= 2;
+    }
+    hash = (_TmateHash *) calloc(n, sizeof(_TmateHash));
+    _assert(hash);
+    hashMask = n - 1;
+}
+
+void MateSearch::probe(const u64 key, unsigned &pn, unsigned &dn) const {
+    const _TmateHash *e = &hash[key & hashMask];
+    if (e->key == key) {
+        pn = e->pn;
+        dn = e->dn;
+    } else {
+        pn = dn = 1;
+    }
+}
+
+void MateSearch::store(const u64 key, const unsigned pn, const unsigned dn) {
+    _TmateHash *e = &hash[key & hashMask];
+    e->key = key;
+    e->pn = pn;
+    e->dn = dn;
+}
+
+void MateSearch::checkRunning() {
+    if (Time::diffTime(std::chrono::high_resolution_clock::now(), startTime) >= maxTimeMillsec ||
+        (runningCheck && !runningCheck())) {
+        stop = true;
+    }
+}
+
+string MateSearch::moveToString(const _Tmove *move) {
+    if (move->type & 0xc) {
+        return decodeBoardinv(move->type, -1, move->side());
+    }
+    string s = string(BOARD[move->from]) + BOARD[move->to];
+    if ((move->type & 0x3) == PROMOTION_MOVE_MASK) {
+        s += (char) tolower(FEN_PIECE[move->promotionPiece]);
+    }
+    return s;
+}
+
+/**
+ * fills the current list with the moves worth trying: checks for the attacker, every legal move for the defender.
+ * childKey receives the table key of each child
+ */
+template<int side>
+int MateSearch::generateChildren(const int movesLeft, u64 *childKey) {
+    const u64 friends = getBitmap<side>();
+    const u64 enemies = getBitmap<side ^ 1>();
+    generateCaptures<LEGAL_MODE, side>(enemies, friends);
+    generateMoves<LEGAL_MODE, side>(friends | enemies);
+
+    const bool orNode = side == attacker;
+    const int childMovesLeft = orNode ? movesLeft - 1 : movesLeft;
+    const u64 oldKey = chessboard[ZOBRISTKEY_IDX];
+    _Tmove *moves = gen_list[listId].moveList;
+    int n = 0;
+    for (int i = 0; i < getListSize(); i++) {
+        makemove(&moves[i], false, false);
+        const bool check = !orNode || inCheck<side ^ 1>();
+        const u64 key = nodeKey(side ^ 1, childMovesLeft);
+        takeback(&moves[i], oldKey, false);
+        if (check) {
+            childKey[n] = key;
+            moves[n++] = moves[i];
+        }
+    }
+    gen_list[listId].size = n;
+    return n;
+}
+
+template<int side>
+void MateSearch::mid(const int movesLeft, const unsigned thPn, const unsigned thDn, unsigned &pn, unsigned &dn) {
+    if (!(++nodes & 0xfff)) {
+        checkRunning();
+    }
+    const bool orNode = side == attacker;
+    ASSERT(!orNode || movesLeft > 0);
+    const u64 key = nodeKey(side, movesLeft);
+    const u64 oldKey = chessboard[ZOBRISTKEY_IDX];
+    const u64 oldEnpassant = chessboard[ENPASSANT_IDX];
+    u64 childKey[MAX_MOVE];
+
+    incListId();
+    const int n = generateChildren<side>(movesLeft, childKey);
+    if (!n) {
+        // no checks left for the attacker, mate or stalemate for the defender
+        if (!orNode && inCheck<side>()) {
+            pn = 0;
+            dn = INF_PN;
+        } else {
+            pn = INF_PN;
+            dn = 0;
+        }
+    } else if (!orNode && !movesLeft) {
+        // the defender has a legal move and the attacker has no moves left
+        pn = INF_PN;
+        dn = 0;
+    } else {
+        const int childMovesLeft = orNode ? movesLeft - 1 : movesLeft;
+        const u64 genKey = chessboard[ZOBRISTKEY_IDX];
+        _Tmove *moves = gen_list[listId].moveList;
+        while (true) {
+            // OR node: pn = min(child pn), dn = sum(child dn). AND node: the opposite
+            u64 sum = 0;
+            unsigned best = UINT_MAX, second = INF_PN, bestOther = 0;
+            int bestIdx = 0;
+            for (int i = 0; i < n; i++) {
+                unsigned cpn, cdn;
+                probe(childKey[i], cpn, cdn);
+                const unsigned v = orNode ? cpn : cdn;
+                if (v < best) {
+                    second = best;
+                    best = v;
+                    bestIdx = i;
+                    bestOther = orNode ? cdn : cpn;
+                } else if (v < second) {
+                    second = v;
+                }
+                sum += orNode ? cdn : cpn;
+            }
+            const unsigned total = (unsigned) min(sum, (u64) INF_PN);
+            pn = orNode ? best : total;
+            dn = orNode ? total : best;
+            if (pn >= thPn || dn >= thDn || stop) {
+                break;
+            }
+            const unsigned thChild = (unsigned) min((u64) (orNode ? thPn : thDn), (u64) second + 1);
+            const unsigned thOther = (unsigned) min((u64) INF_PN,
+                                                    (u64) (orNode ? thDn - dn : thPn - pn) + bestOther);
+            unsigned cpn, cdn;
+            makemove(&moves[bestIdx], false, false);
+            if (orNode) {
+                mid<side ^ 1>(childMovesLeft, thChild, thOther, cpn, cdn);
+            } else {
+                mid<side ^ 1>(childMovesLeft, thOther, thChild, cpn, cdn);
+            }
+            takeback(&moves[bestIdx], genKey, false);
+        }
+    }
+    decListId();
+    if (!stop) {
+        store(key, pn, dn);
+    }
+    chessboard[ENPASSANT_IDX] = oldEnpassant;
+    chessboard[ZOBRISTKEY_IDX] = oldKey;
+}
+
+template<int side>
+void MateSearch::buildPv(const int movesLeft, const int ply) {
+    const bool orNode = side == attacker;
+    if (ply >= MAX_PLY - 1 || (orNode && !movesLeft)) {
+        return;
+    }
+    const u64 oldKey = chessboard[ZOBRISTKEY_IDX];
+    const u64 oldEnpassant = chessboard[ENPASSANT_IDX];
+    u64 childKey[MAX_MOVE];
+    incListId();
+    const int n = generateChildren<side>(movesLeft, childKey);
+    const u64 genKey = chessboard[ZOBRISTKEY_IDX];
+    for (int i = 0; i < n && (orNode || movesLeft); i++) {
+        unsigned cpn, cdn;
+        probe(childKey[i], cpn, cdn);
+        if (!cpn) {
+            _Tmove *move = getMove(i);
+            if (!ply) {
+                bestmove = moveToString(move);
+            }
+            pv += moveToString(move) + " ";
+            makemove(move, false, false);
+            buildPv<side ^ 1>(orNode ? movesLeft - 1 : movesLeft, ply + 1);
+            takeback(move, genKey, false);
+            break;
+        }
+    }
+    decListId();
+    chessboard[ENPASSANT_IDX] = oldEnpassant;
+    chessboard[ZOBRISTKEY_IDX] = oldKey;
+}
+
+int MateSearch::search(const string &fen, const int maxMoves) {
+    if (!hash) {
+        setHashSize(hashSizeMb);
+    }
+    loadFen(fen);
+    attacker = getSide();
+    nodes = 0;
+    stop = false;
+    startTime = std::chrono::high_resolution_clock::now();
+    bestmove.clear();
+    pv.clear();
+    for (int n = 1; n <= maxMoves && n < MAX_PLY / 2 && !stop; n++) {
+        unsigned pn, dn;
+        if (attacker == WHITE) {
+            mid<WHITE>(n, INF_PN, INF_PN, pn, dn);
+        } else {
+            mid<BLACK>(n, INF_PN, INF_PN, pn, dn);
+        }
+        if (!pn && !stop) {
+            if (attacker == WHITE) {
+                buildPv<WHITE>(n, 0);
+            } else {
+                buildPv<BLACK>(n, 0);
+            }
+            return n;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+    Cinnamon UCI chess engine
+    Copyright (C) Giuseppe Cannella
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "../GenMoves.h"
+#include "../util/Time.h"
+#include <climits>
+#include <functional>
+
+/**
+ * Depth-first proof-number search (df-pn) for forced mates.
+ * The attacker plays only checking moves, the defender every legal evasion.
+ * Proof and disproof numbers are kept in a private transposition table keyed
+ * on the position and on the number of attacker moves left.
+ */
+class MateSearch: public GenMoves {
+
+public:
+
+    MateSearch();
+
+    virtual ~MateSearch();
+
+    /// looks for a mate in at most maxMoves moves, returns the mate length or 0 if none was proved
+    int search(const string &fen, const int maxMoves);
+
+    void setHashSize(const int mb);
+
+    void setMaxTimeMillsec(const int t) {
+        maxTimeMillsec = t;
+    }
+
+    /// polled during the search, the search stops as soon as it returns false
+    void setRunningCheck(function<bool(void)> f) {
+        runningCheck = f;
+    }
+
+    const string &getBestmove() const {
+        return bestmove;
+    }
+
+    const string &getPv() const {
+        return pv;
+    }
+
+    u64 getNodes() const {
+        return nodes;
+    }
+
+private:
+
+    typedef struct {
+        u64 key;
+        unsigned pn;
+        unsigned dn;
+    } _TmateHash;
+
+    static constexpr unsigned INF_PN = 100000000;
+
+    _TmateHash *hash = nullptr;
+    u64 hashMask = 0;
+    int hashSizeMb = 32;
+    int attacker;
+    u64 nodes;
+    bool stop;
+    int maxTimeMillsec = 0x7FFFFFFF;
+    high_resolution_clock::time_point startTime;
+    function<bool(void)> runningCheck;
+    string bestmove;
+    string pv;
+
+    template<int side>
+    void mid(const int movesLeft, const unsigned thPn, const unsigned thDn, unsigned &pn, unsigned &dn);
+
+    template<int side>
+    int generateChildren(const int movesLeft, u64 *childKey);
+
+    template<int side>
+    void buildPv(const int movesLeft, const int ply);
+
+    u64 nodeKey(const int side, const int movesLeft) const {
+        return chessboard[ZOBRISTKEY_IDX] ^ _random::RANDSIDE[side] ^ (0x9E3779B97F4A7C15ULL * (movesLeft + 1));
+    }
+
+    void probe(const u64 key, unsigned &pn, unsigned &dn) const;
+
+    void store(const u64 key, const unsigned pn, const unsigned dn);
+
+    void checkRunning();
+
+    static string moveToString(const _Tmove *move);
+};
+
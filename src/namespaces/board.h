@@ -62,6 +62,19 @@ namespace _board {
         {VALUEPAWN, VALUEPAWN, VALUEROOK, VALUEROOK, VALUEBISHOP, VALUEBISHOP, VALUEKNIGHT, VALUEKNIGHT, VALUEKING,
          VALUEKING, VALUEQUEEN, VALUEQUEEN, 0};
 
+    /// material signature deltas: dense index of the material table in the low 24 bits, one count per nibble from bit 24
+    static constexpr array<u64, 12> MATERIAL_KEY =
+        {1ULL | 1ULL << 24, 486ULL | 1ULL << 28, 81ULL | 1ULL << 32, 81ULL * 486 | 1ULL << 36, 27ULL | 1ULL << 40,
+         27ULL * 486 | 1ULL << 44, 9ULL | 1ULL << 48, 9ULL * 486 | 1ULL << 52, 0, 0, 243ULL | 1ULL << 56,
+         243ULL * 486 | 1ULL << 60};
+    /// position of the count nibble of each piece in the signature, kings have none
+    static constexpr array<int, 12> MATERIAL_COUNT_SHIFT = {24, 28, 32, 36, 40, 44, 48, 52, 0, 0, 56, 60};
+    static constexpr int MATERIAL_TABLE_SIZE = 486 * 486;
+    static constexpr u64 MATERIAL_INDEX_MASK = 0xffffffULL;
+    /// added to the counts it sets the top bit of a nibble for more than 2 rooks, bishops, knights or 1 queen
+    static constexpr u64 MATERIAL_BIAS = 0x6655555500ULL;
+    static constexpr u64 MATERIAL_GUARD = 0x8888888800ULL;
+
     static constexpr u64 CENTER_MASK = 0x1818000000ULL;
     static constexpr u64 BIG_DIAGONAL = 0x102040810204080ULL;
     static constexpr u64 BIG_ANTIDIAGONAL = 0x8040201008040201ULL;
@@ -139,25 +152,56 @@ namespace _board {
     static constexpr int E7 = 51;
     static constexpr int E8 = 59;
 
-    typedef struct {
-        char promotionPiece;
-        char pieceFrom;
-        uchar capturedPiece;
-        uchar from;
-        uchar to;
-        char side;
-        uchar type;
-        int score;
-        bool used;
-    } _Tmove;
+    /// a move in 32 bits, the ordering score is kept apart in _TmoveP::score
+    struct _Tmove {
+        unsigned from: 6;
+        unsigned to: 6;
+        /// moving piece, the king for castles: its low bit is the side
+        unsigned pieceFrom: 4;
+        unsigned capturedPiece: 4;
+        /// meaningful only for PROMOTION_MOVE_MASK moves
+        unsigned promotionPiece: 4;
+        /// move kind in the low nibble, castle rights before the move in the high one
+        unsigned type: 8;
+
+        int side() const {
+            return pieceFrom & 1;
+        }
+
+        /// builds the move in a register and stores it at once, gcc writes a bitfield aggregate as a
+        /// read-modify-write of the old word followed by a byte store, which stalls the next load of the move.
+        /// Bitfields are allocated from the low bit on every supported target (x86-64, arm, wasm)
+        static _Tmove pack(const unsigned from, const unsigned to, const unsigned pieceFrom,
+                           const unsigned capturedPiece, const unsigned promotionPiece, const unsigned type) {
+            const unsigned raw = from | to << 6 | pieceFrom << 12 | capturedPiece << 16 |
+                                 (promotionPiece & 0xf) << 20 | type << 24;
+            _Tmove move;
+            memcpy(&move, &raw, sizeof(move));
+            return move;
+        }
+    };
 
+    static_assert(sizeof(_Tmove) == 4, "_Tmove must fit in 32 bits");
+
+    /// moves of one ply and their ordering scores in parallel arrays
     typedef struct {
         _Tmove *moveList;
+        int *score;
         int size;
     } _TmoveP;
 
+    static constexpr int MAX_MOVE = 130;
+
+    /// fixed capacity move list owned by the caller, filled by GenMoves::generateLegalMoves
+    typedef struct {
+        _Tmove moveList[MAX_MOVE];
+        int score[MAX_MOVE];
+    } _TmoveBuffer;
+
     typedef struct {
         int cmove;
+        /// score of argmove[0]
+        int score;
         _Tmove argmove[MAX_PLY];
     } _TpvLine;
 
@@ -23,6 +23,15 @@
 #include "../util/FileUtil.h"
 #include "debug.h"
 #include <array>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#ifdef BENCH_MODE
+#include "../util/TableStats.h"
+#endif
 
 using namespace _debug;
 
@@ -34,7 +43,15 @@ namespace _def {
 
     typedef unsigned char uchar;
     typedef long long unsigned u64;
-    typedef u64 _Tchessboard[16];
+    typedef u64 _Tchessboard[17];
+
+    static constexpr int CACHE_LINE = 64;
+
+    /// a value alone on its cache line, for the flags every search thread reads on every node
+    template<typename T>
+    struct alignas(CACHE_LINE) _TcacheLine {
+        T value;
+    };
 
 #define RESET_LSB(bits) (bits&=bits-1)
 
@@ -48,8 +65,11 @@ namespace _def {
 
 #ifdef BENCH_MODE
 #define BENCH(a) a
+/// the constant table t, counting its lookups at this call site
+#define TABLE(t) ([]() -> decltype(t) & { static TableStats _stats(#t, sizeof(t)); _stats.hit(); return t; }())
 #else
 #define BENCH(a)
+#define TABLE(t) t
 #endif
 
 #ifdef DEBUG_MODE
@@ -69,7 +89,27 @@ namespace _def {
 #endif
 
 
-#ifdef HAS_POPCNT
+/// a build without HAS_POPCNT clones the hot kernels for x86-64-v3 (avx2 bmi2 lzcnt popcnt), popcnt and the
+/// baseline, the loader picks the best one for the cpu
+#if !defined(HAS_POPCNT) && !defined(DEBUG_MODE) && !defined(JS_MODE) && defined(HAS_64BIT) && defined(__x86_64__) && \
+    defined(__linux__) && defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 12
+#define MULTI_TARGET
+#define HOT_KERNEL __attribute__((target_clones("arch=x86-64-v3", "popcnt", "default")))
+
+    /// the clone the loader picks
+    static inline const char *getCpuPath() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("x86-64-v3")) {
+            return "x86-64-v3";
+        }
+        return __builtin_cpu_supports("popcnt") ? "popcnt" : "default";
+    }
+
+#else
+#define HOT_KERNEL
+#endif
+
+#if defined(HAS_POPCNT) || defined(MULTI_TARGET)
 #ifdef HAS_64BIT
 
     static inline int bitCount(const u64 bits) {
@@ -92,7 +132,17 @@ namespace _def {
 #endif
 
 
-#ifdef HAS_BSF
+#ifdef MULTI_TARGET
+
+    static inline int BITScanForward(const u64 bits) {
+        return __builtin_ctzll(bits);
+    }
+
+    static inline int BITScanReverse(const u64 bits) {
+        return 63 ^ __builtin_clzll(bits);
+    }
+
+#elif defined(HAS_BSF)
 #ifdef HAS_64BIT
 
     static inline int BITScanForward(const u64 bits) {
@@ -165,4 +215,22 @@ namespace _def {
     static inline int BITScanForwardUnset(const u64 bb) {
         return BITScanForward(~bb);
     }
+
+    /// malloc on a cache line boundary so that the buffers of two threads never share a line, release with alignedFree
+    static inline void *alignedMalloc(const size_t size) {
+#ifdef _WIN32
+        return _aligned_malloc(size, CACHE_LINE);
+#else
+        void *p;
+        return posix_memalign(&p, CACHE_LINE, size) ? nullptr : p;
+#endif
+    }
+
+    static inline void alignedFree(void *p) {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        free(p);
+#endif
+    }
 }
@@ -157,10 +157,11 @@ void Perft::run() {
         perftRes.nCpu = 1;
     }
     PerftThread *p = new PerftThread();
-    if (!fen.empty()) {
-        p->loadFen(fen);
+    if (p->loadFen(fen) == ChessBoard::FEN_ERROR) {
+        cout << "bad fen " << fen << endl;
+        delete p;
+        return;
     }
-    p->setPerft(true);
     int side = p->getSide() ? 1 : 0;
     p->display();
     cout << "fen:\t\t\t" << fen << endl;
@@ -189,8 +190,8 @@ void Perft::run() {
     p->incListId();
     u64 friends = side ? p->getBitmap<WHITE>() : p->getBitmap<BLACK>();
     u64 enemies = side ? p->getBitmap<BLACK>() : p->getBitmap<WHITE>();
-    p->generateCaptures(side, enemies, friends);
-    p->generateMoves(side, friends | enemies);
+    p->generateCaptures<PerftThread::PERFT_MODE>(side, enemies, friends);
+    p->generateMoves<PerftThread::PERFT_MODE>(side, friends | enemies);
     int listcount = p->getListSize();
     count = listcount;
     delete (p);
@@ -21,7 +21,7 @@
 
 Spinlock PerftThread::spinlockPrint;
 
-PerftThread::PerftThread() { perftMode = true; }
+PerftThread::PerftThread() {}
 
 void PerftThread::setParam(const string &fen1, const int from1, const int to1, _TPerftRes *perft1) {
 
@@ -59,9 +59,9 @@ vector <string> PerftThread::getSuccessorsFen(const int depthx) {
     incListId();
     u64 friends = getBitmap<side>();
     u64 enemies = getBitmap<side ^ 1>();
-    generateCaptures<side>(enemies, friends);
+    generateCaptures<PERFT_MODE, side>(enemies, friends);
 
-    generateMoves<side>(friends | enemies);
+    generateMoves<PERFT_MODE, side>(friends | enemies);
     listcount = getListSize();
     if (!listcount) {
         decListId();
@@ -85,7 +85,7 @@ vector <string> PerftThread::getSuccessorsFen(const int depthx) {
 
 
 template<int side, bool useHash>
-u64 PerftThread::search(const int depthx) {
+HOT_KERNEL u64 PerftThread::search(const int depthx) {
     checkWait();
     if (depthx == 0) {
         return 1;
@@ -109,9 +109,9 @@ u64 PerftThread::search(const int depthx) {
     incListId();
     u64 friends = getBitmap<side>();
     u64 enemies = getBitmap<side ^ 1>();
-    generateCaptures<side>(enemies, friends);
+    generateCaptures<PERFT_MODE, side>(enemies, friends);
 
-    generateMoves<side>(friends | enemies);
+    generateMoves<PERFT_MODE, side>(friends | enemies);
     listcount = getListSize();
     if (!listcount) {
         decListId();
@@ -143,8 +143,8 @@ void PerftThread::run() {
     resetList();
     const u64 friends = chessboard[SIDETOMOVE_IDX] ? getBitmap<WHITE>() : getBitmap<BLACK>();
     const u64 enemies = chessboard[SIDETOMOVE_IDX] ? getBitmap<BLACK>() : getBitmap<WHITE>();
-    generateCaptures(chessboard[SIDETOMOVE_IDX], enemies, friends);
-    generateMoves(chessboard[SIDETOMOVE_IDX], friends | enemies);
+    generateCaptures<PERFT_MODE>(chessboard[SIDETOMOVE_IDX], enemies, friends);
+    generateMoves<PERFT_MODE>(chessboard[SIDETOMOVE_IDX], friends | enemies);
 
     makeZobristKey();
     const u64 keyold = chessboard[ZOBRISTKEY_IDX];
@@ -31,4 +31,39 @@ TEST(eval, eval1) {
     EXPECT_EQ(-5, score);
 }
 
+TEST(eval, endgame) {
+    SearchManager &searchManager = Singleton<SearchManager>::getInstance();
+    //kpk
+    searchManager.loadFen("k7/8/8/8/8/8/P7/K7 w - - 0 1");
+    searchManager.clearHash();
+    EXPECT_EQ(0, searchManager.getScore(WHITE, false));
+    searchManager.loadFen("4k3/8/4K3/4P3/8/8/8/8 b - - 0 1");
+    searchManager.clearHash();
+    EXPECT_LT(searchManager.getScore(BLACK, false), -VALUEROOK);
+
+    //kbnk, the weak king is pushed to a corner of the bishop color
+    searchManager.loadFen("7k/8/8/8/4K3/8/8/1BN5 w - - 0 1");
+    searchManager.clearHash();
+    const int badCorner = searchManager.getScore(WHITE, false);
+    EXPECT_GT(badCorner, VALUEROOK);
+    searchManager.loadFen("k7/8/8/8/4K3/8/8/1BN5 w - - 0 1");
+    searchManager.clearHash();
+    EXPECT_GT(searchManager.getScore(WHITE, false), badCorner);
+
+    //krk from black
+    searchManager.loadFen("8/8/8/3k4/8/8/6r1/7K b - - 0 1");
+    searchManager.clearHash();
+    EXPECT_GT(searchManager.getScore(BLACK, false), VALUEROOK);
+}
+
+TEST(eval, pawnHash) {
+    SearchManager &searchManager = Singleton<SearchManager>::getInstance();
+    //the second call finds the pawn structure in the pawn hash
+    searchManager.loadFen("r1bq1rk1/pp3ppp/2n1pn2/2pp4/1bPP4/2NBPN2/PP3PPP/R1BQ1RK1 w - - 0 1");
+    searchManager.clearHash();
+    const int score = searchManager.getScore(WHITE, false);
+    searchManager.clearHash();
+    EXPECT_EQ(score, searchManager.getScore(WHITE, false));
+}
+
 #endif
\ No newline at end of file
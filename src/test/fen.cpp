@@ -0,0 +1,83 @@
+/*
+    Cinnamon UCI chess engine
+    Copyright (C) Giuseppe Cannella
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#if defined(FULL_TEST)
+
+#include <gtest/gtest.h>
+#include "../ChessBoard.h"
+
+TEST(fen, roundTrip) {
+    const string fens[] = {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b Kq e3 0 1",
+        "rnbqkbnr/pppp1pp1/8/3Pp2p/8/8/PPP1PPPP/RNBQKBNR w kq e6 0 1",
+        "8/p5p1/k3p1p1/5pP1/5PKP/bP2r3/P7/3RB3 w - - 0 1",
+        "7k/8/8/8/8/8/6q1/7K b - - 0 1",
+        "8/8/8/8/8/8/6k1/4K3 b - - 37 1"};
+    ChessBoard a;
+    char buf[ChessBoard::FEN_MAX_LENGTH];
+    for (const string &fen:fens) {
+        const int side = a.loadFen(fen.data(), fen.data() + fen.size());
+        EXPECT_EQ(fen.find(" w ") != string::npos ? WHITE : BLACK, side);
+        EXPECT_EQ((int) fen.size(), a.boardToFen(buf));
+        EXPECT_EQ(fen, string(buf));
+        EXPECT_EQ(fen, a.boardToFen());
+#ifdef DEBUG_MODE
+        EXPECT_TRUE(a.checkIncremental());
+#endif
+    }
+    //the halfmove clock is kept, the fullmove number is not tracked
+    const string fifty = "8/8/8/8/8/8/6k1/4K3 b - - 37 80";
+    a.loadFen(fifty.data(), fifty.data() + fifty.size());
+    EXPECT_EQ("8/8/8/8/8/8/6k1/4K3 b - - 37 1", a.boardToFen());
+}
+
+TEST(fen, epd) {
+    _Tchessboard b, c;
+    int fifty = -1;
+    const char *epd = "  r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - bm Bb5; id \"ruy\";\n";
+    EXPECT_EQ(WHITE, ChessBoard::parseFen(epd, epd + strlen(epd), b, fifty));
+    EXPECT_EQ(0, fifty);
+    const char *fen = "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 0 1";
+    EXPECT_EQ(WHITE, ChessBoard::parseFen(fen, fen + strlen(fen), c, fifty));
+    EXPECT_EQ(0, memcmp(b, c, sizeof(_Tchessboard)));
+
+    fen = "8/8/8/8/8/8/6k1/4K3 b - - 37 80";
+    EXPECT_EQ(BLACK, ChessBoard::parseFen(fen, fen + strlen(fen), b, fifty));
+    EXPECT_EQ(37, fifty);
+}
+
+TEST(fen, error) {
+    const string bad[] = {
+        "",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBN w KQkq - 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNRR w KQkq - 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR x KQkq - 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQxq - 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq e3 0 1",
+        "rnbqkbnr/pppppppp/9/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR"};
+    ChessBoard a;
+    const string start = a.boardToFen();
+    for (const string &fen:bad) {
+        EXPECT_EQ((int) ChessBoard::FEN_ERROR, a.loadFen(fen.data(), fen.data() + fen.size())) << fen;
+        EXPECT_EQ(start, a.boardToFen());
+    }
+}
+
+#endif
@@ -0,0 +1,43 @@
+/*
+    Cinnamon UCI chess engine
+    Copyright (C) Giuseppe Cannella
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if defined(FULL_TEST)
+
+#include <gtest/gtest.h>
+#include "../mate/MateSearch.h"
+
+TEST(mate, test1) {
+    MateSearch mateSearch;
+    EXPECT_EQ(1, mateSearch.search("r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5Q2/PPPP1PPP/RNB1K1NR w KQkq - 0 1", 3));
+    EXPECT_EQ("f3f7", mateSearch.getBestmove());
+}
+
+TEST(mate, test2) {
+    MateSearch mateSearch;
+    EXPECT_EQ(2, mateSearch.search("r2qkb1r/pp2nppp/3p4/2pNN1B1/2BnP3/3P4/PPP2PPP/R2bK2R w KQkq - 1 0", 3));
+    EXPECT_EQ("d5f6", mateSearch.getBestmove());
+    EXPECT_EQ(3, mateSearch.search("1k5r/pP3ppp/3p2b1/1BN1n3/1Q2P3/P1B5/KP3P1P/7q w - - 0 1", 3));
+}
+
+TEST(mate, noMate) {
+    MateSearch mateSearch;
+    EXPECT_EQ(0, mateSearch.search("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 3));
+    EXPECT_EQ(0, mateSearch.search("8/8/8/8/8/5k2/8/5K2 w - - 0 1", 3));
+}
+
+#endif
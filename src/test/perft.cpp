@@ -38,6 +38,25 @@ TEST(perftTest, twoCore) {
     ASSERT_EQ(97862, perft->getResult());
 }
 
+TEST(perftTest, legalMoves) {
+    const vector<pair<string, int>> positions = {
+        {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 48},
+        {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",                              14},
+        {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",       6},
+        {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",              44},
+        {"8/p5p1/k3p1p1/5pP1/5PKP/bP2r3/P7/3RB3 w - f6 0 1",                       1}};
+    GenMoves genMoves;
+    _TmoveBuffer moves;
+    for (const auto &p:positions) {
+        genMoves.loadFen(p.first);
+        const u64 key = genMoves.getChessboard()[ZOBRISTKEY_IDX];
+        EXPECT_EQ(p.second, genMoves.generateLegalMoves(moves));
+        //the board is left as it was, en passant square included
+        EXPECT_EQ(p.second, genMoves.generateLegalMoves(moves));
+        EXPECT_EQ(key, genMoves.getChessboard()[ZOBRISTKEY_IDX]);
+    }
+}
+
 #ifdef FULL_TEST
 TEST(perftTest, fullTest) {
     Perft *perft = &Perft::getInstance();
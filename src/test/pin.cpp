@@ -72,4 +72,31 @@ TEST(pin, test1) {
 
 }
 
+TEST(pin, givesCheck) {
+    GenMoves s;
+    const pair<string, int> positions[] = {
+        {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 0},
+        {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 2},
+        {"5k2/8/8/3pP3/8/8/8/4K2R w K d6 0 1", 3},
+        {"3k4/1P6/8/8/8/8/6B1/4K3 w - - 0 1", 2},
+        {"4k3/8/8/8/4N3/8/8/4R1K1 w - - 0 1", 8}
+    };
+    for (const auto &position:positions) {
+        s.loadFen(position.first);
+        const u64 friends = s.getBitmap<WHITE>();
+        const u64 enemies = s.getBitmap<BLACK>();
+        GenMoves::_TcheckInfo info;
+        s.getCheckInfo<WHITE>(info, friends | enemies, friends);
+        s.incListId();
+        s.generateCaptures<GenMoves::PERFT_MODE>(WHITE, enemies, friends);
+        s.generateMoves<GenMoves::PERFT_MODE>(WHITE, friends | enemies);
+        int checks = 0;
+        for (int i = 0; i < s.getListSize(); i++) {
+            if (s.givesCheck<WHITE>(s.getMove(i), info))checks++;
+        }
+        s.decListId();
+        EXPECT_EQ(position.second, checks);
+    }
+}
+
 #endif
\ No newline at end of file
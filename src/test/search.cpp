@@ -33,6 +33,49 @@ TEST(search, test0) {
     EXPECT_EQ("e3g5", it.getBestmove());
 }
 
+TEST(search, mtdf) {
+    IterativeDeeping it;
+    it.loadFen("8/pp6/5p1k/2P3Pp/P1P4K/4q1PP/8/6Q1 b - - 0 35");
+    SearchManager &searchManager = Singleton<SearchManager>::getInstance();
+    searchManager.setMaxTimeMillsec(250);
+    searchManager.setMtdf(true);
+    it.start();
+    it.join();
+    searchManager.setMtdf(false);
+    EXPECT_EQ("e3g5", it.getBestmove());
+}
+
+TEST(search, deterministic) {
+    SearchManager &searchManager = Singleton<SearchManager>::getInstance();
+    searchManager.setDeterministic(true);
+    string bestmove[2];
+    for (int i = 0; i < 2; i++) {
+        IterativeDeeping it;
+        it.loadFen("r2q1rk1/1b1nbppp/p2ppn2/1p6/3NPP2/1BN1B3/PPP1Q1PP/R4RK1 w - - 0 12");
+        it.setMaxNodes(100000);
+        it.start();
+        it.join();
+        bestmove[i] = it.getBestmove();
+    }
+    searchManager.setDeterministic(false);
+    EXPECT_FALSE(bestmove[0].empty());
+    EXPECT_EQ(bestmove[0], bestmove[1]);
+}
+
+TEST(search, singleMove) {
+    IterativeDeeping it;
+    it.loadFen("7k/8/8/8/8/8/6q1/7K w - - 0 1");
+    SearchManager &searchManager = Singleton<SearchManager>::getInstance();
+    searchManager.setMaxTimeMillsec(10000);
+    it.setTimeControl(true);
+    auto start = std::chrono::high_resolution_clock::now();
+    it.start();
+    it.join();
+    it.setTimeControl(false);
+    EXPECT_EQ("h1g2", it.getBestmove());
+    EXPECT_LT(Time::diffTime(std::chrono::high_resolution_clock::now(), start), 1000);
+}
+
 TEST(search, test1) {
     IterativeDeeping it;
     it.loadFen("8/p5p1/k3p1p1/5pP1/5PKP/bP2r3/P7/3RB3 w - f6");
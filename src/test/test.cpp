@@ -25,8 +25,11 @@
 #include "spinlockShared.cpp"
 #include "spinlock.cpp"
 #include "search.cpp"
+#include "mate.cpp"
 #include "util/fileUtil.cpp"
 #include "util/string.cpp"
+#include "util/bitboard.cpp"
+#include "fen.cpp"
 #include "perft.cpp"
 
 #endif
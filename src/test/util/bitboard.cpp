@@ -0,0 +1,81 @@
+/*
+    Cinnamon UCI chess engine
+    Copyright (C) Giuseppe Cannella
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if defined(FULL_TEST)
+
+#include <gtest/gtest.h>
+#include <random>
+#include "../../util/Bitboard.h"
+#include "../../util/SliderFill.h"
+
+static u64 slide(const int position, const u64 allpieces, const int dirs[4][2]) {
+    u64 res = 0;
+    for (int d = 0; d < 4; d++) {
+        int file = (position & 7) + dirs[d][0];
+        int rank = (position >> 3) + dirs[d][1];
+        for (; file >= 0 && file < 8 && rank >= 0 && rank < 8; file += dirs[d][0], rank += dirs[d][1]) {
+            res |= POW2[rank * 8 + file];
+            if (allpieces & POW2[rank * 8 + file]) {
+                break;
+            }
+        }
+    }
+    return res;
+}
+
+TEST(bitboard, sliders) {
+    const int rookDirs[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+    const int bishopDirs[4][2] = {{1, 1}, {-1, -1}, {1, -1}, {-1, 1}};
+    Bitboard bitboard;
+    std::mt19937_64 rnd(64);
+    for (int i = 0; i < 20000; i++) {
+        const u64 allpieces = rnd() & rnd();
+        const int position = i & 63;
+        EXPECT_EQ(slide(position, allpieces, rookDirs), Bitboard::getRankFile(position, allpieces));
+        EXPECT_EQ(slide(position, allpieces, bishopDirs), Bitboard::getDiagonalAntiDiagonal(position, allpieces));
+    }
+}
+
+TEST(bitboard, sliderFill) {
+    Bitboard bitboard;
+    std::mt19937_64 rnd(64);
+    for (int i = 0; i < 20000; i++) {
+        const u64 allpieces = rnd() & rnd();
+        const u64 rooks[2] = {allpieces & rnd() & rnd(), allpieces & rnd() & rnd()};
+        const u64 bishops[2] = {allpieces & rnd() & rnd(), allpieces & rnd() & rnd()};
+        u64 expected[2] = {0, 0};
+        for (int side = 0; side < 2; side++) {
+            u64 rankFile = 0, diag = 0;
+            for (u64 x = rooks[side]; x; RESET_LSB(x)) {
+                rankFile |= Bitboard::getRankFile(BITScanForward(x), allpieces);
+            }
+            for (u64 x = bishops[side]; x; RESET_LSB(x)) {
+                diag |= Bitboard::getDiagonalAntiDiagonal(BITScanForward(x), allpieces);
+            }
+            EXPECT_EQ(rankFile, SliderFill::getRankFileFill(rooks[side], allpieces));
+            EXPECT_EQ(diag, SliderFill::getDiagonalAntiDiagonalFill(bishops[side], allpieces));
+            expected[side] = rankFile | diag;
+        }
+        u64 attacks[2];
+        SliderFill::getSliderAttacks(rooks, bishops, allpieces, attacks);
+        EXPECT_EQ(expected[BLACK], attacks[BLACK]);
+        EXPECT_EQ(expected[WHITE], attacks[WHITE]);
+    }
+}
+
+#endif
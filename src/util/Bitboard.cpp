@@ -17,294 +17,161 @@
 */
 
 #include "Bitboard.h"
+#include "SliderFill.h"
+#include <iomanip>
+#include <fstream>
 
+#ifdef KINDERGARTEN
 u64 Bitboard::BITBOARD_DIAGONAL[64][256];
 u64 Bitboard::BITBOARD_ANTIDIAGONAL[64][256];
 u64 Bitboard::BITBOARD_FILE[64][256];
 u64 Bitboard::BITBOARD_RANK[64][256];
+#elif defined(HAS_PEXT)
+Bitboard::_Tmagic Bitboard::ROOK_MAGIC[64];
+Bitboard::_Tmagic Bitboard::BISHOP_MAGIC[64];
+u64 Bitboard::ROOK_ATTACKS[ROOK_ATTACKS_SIZE];
+u64 Bitboard::BISHOP_ATTACKS[BISHOP_ATTACKS_SIZE];
+#else
+
+#include "BitboardTables.h"
+
+#endif
+#if defined(KINDERGARTEN) || defined(HAS_PEXT)
 volatile bool Bitboard::generated = false;
 mutex Bitboard::mutexConstructor;
+#endif
 
 Bitboard::Bitboard() {
+#if defined(KINDERGARTEN) || defined(HAS_PEXT)
     std::lock_guard <std::mutex> lock(mutexConstructor);
     if (generated) {
         return;
     }
-    tmpStruct = (_Ttmp *) malloc(sizeof(_Ttmp));
-    u64 MASK_BIT_SET[64][64];
-    memset(MASK_BIT_SET, 0, sizeof(MASK_BIT_SET));
-    for (int i = 0; i < 64; i++) {
-        for (int j = 0; j < 64; j++) {
-            int a = min(i, j);
-            int b = max(i, j);
-            MASK_BIT_SET[i][i] = 0;
-            for (int e = a; e <= b; e++) {
-                u64 r = (RANK[i] | POW2[i]) & (RANK[j] | POW2[j]);
-                if (r) {
-                    MASK_BIT_SET[i][j] |= POW2[e] & r;
-                } else {
-                    r = (FILE_[i] | POW2[i]) & (FILE_[j] | POW2[j]);
-                    if (r) {
-                        MASK_BIT_SET[i][j] |= POW2[e] & r;
-                    } else {
-                        r = (DIAGONAL[i] | POW2[i]) & (DIAGONAL[j] | POW2[j]);
-                        if (r) {
-                            MASK_BIT_SET[i][j] |= POW2[e] & r;
-                        } else {
-                            r = (ANTIDIAGONAL[i] | POW2[i]) & (ANTIDIAGONAL[j] | POW2[j]);
-                            if (r) {
-                                MASK_BIT_SET[i][j] |= POW2[e] & r;
-                            }
-                        }
-                    }
-                }
-            }
-            if (i == j) {
-                MASK_BIT_SET[i][i] &= NOTPOW2[i];
-            }
-        }
-    }
-    for (int i = 0; i < 64; i++) {
-        for (int j = 0; j < 64; j++) {
-            tmpStruct->MASK_BIT_SET_NOBOUND_TMP[i][j] = MASK_BIT_SET[i][j];
-            tmpStruct->MASK_BIT_SET_NOBOUND_TMP[i][j] &= NOTPOW2[i];
-            tmpStruct->MASK_BIT_SET_NOBOUND_TMP[i][j] &= NOTPOW2[j];
-            MASK_BIT_SET[i][j] &= NOTPOW2[i];
-        }
-    }
-    for (int i = 0; i < 64; i++) {
-        for (int j = 0; j < 64; j++) {
-            tmpStruct->MASK_BIT_SET_NOBOUND_COUNT_TMP[i][j] = bitCount(tmpStruct->MASK_BIT_SET_NOBOUND_TMP[i][j]);
-        }
-    }
-
-    popolateAntiDiagonal();
-    popolateDiagonal();
-    popolateColumn();
-    popolateRank();
-    free(tmpStruct);
-    tmpStruct = nullptr;
+#ifdef KINDERGARTEN
+    popolateLine(BITBOARD_DIAGONAL, _board::DIAGONAL.data(), false, diagonalIdx);
+    popolateLine(BITBOARD_ANTIDIAGONAL, _board::ANTIDIAGONAL.data(), false, antiDiagonalIdx);
+    popolateLine(BITBOARD_FILE, FILE_.data(), true, fileIdx);
+    popolateLine(BITBOARD_RANK, RANK.data(), true, rankIdx);
+#else
+    popolateMagic(true);
+    popolateMagic(false);
+#endif
     generated = true;
+#endif
 }
 
-void Bitboard::popolateDiagonal() {
-    vector <u64> combinationsDiagonal;
-    for (uchar pos = 0; pos < 64; pos++) {
-        combinationsDiagonal = getCombination(_board::DIAGONAL[pos]);
-        for (u64 allpieces:combinationsDiagonal) {
-            uchar idx = diagonalIdx(pos, allpieces);
-            BITBOARD_DIAGONAL[pos][idx] = performDiagShift(pos, allpieces) | performDiagCapture(pos, allpieces);
-        }
-    }
+template<class F>
+void Bitboard::forEachOccupancy(const bool rook, const int position, const u64 mask, F f) {
+    u64 allpieces = 0;
+    do {
+        f(allpieces, rook ? SliderFill::getRankFileFill(POW2[position], allpieces)
+                          : SliderFill::getDiagonalAntiDiagonalFill(POW2[position], allpieces));
+        allpieces = (allpieces - mask) & mask;
+    } while (allpieces);
 }
 
-void Bitboard::popolateColumn() {
-    vector <u64> combinationsColumn;
-    for (uchar pos = 0; pos < 64; pos++) {
-        combinationsColumn = getCombination(_board::FILE_[pos]);
-        for (u64 allpieces:combinationsColumn) {
-            uchar idx = fileIdx(pos, allpieces);
-            BITBOARD_FILE[pos][idx] = performColumnShift(pos, allpieces) | performColumnCapture(pos, allpieces);
-        }
+Bitboard::_Tmagic Bitboard::getMagic(const bool rook, const int position) {
+    constexpr u64 EDGE_RANKS = 0xff000000000000ffULL;
+    constexpr u64 EDGE_FILES = 0x8181818181818181ULL;
+    _Tmagic m;
+    if (rook) {
+        m.mask = ((FILE_[position] & ~EDGE_RANKS) | (RANK[position] & ~EDGE_FILES)) & NOTPOW2[position];
+        m.magic = _bitboardTmp::ROOK_MAGIC_KEY[position];
+    } else {
+        m.mask = (_board::DIAGONAL[position] | _board::ANTIDIAGONAL[position]) & ~(EDGE_RANKS | EDGE_FILES) &
+            NOTPOW2[position];
+        m.magic = _bitboardTmp::BISHOP_MAGIC_KEY[position];
     }
+    m.shift = 64 - bitCount(m.mask);
+    m.attacks = nullptr;
+    return m;
 }
 
-void Bitboard::popolateRank() {
-    vector <u64> combinationsRank;
-    for (uchar pos = 0; pos < 64; pos++) {
-        combinationsRank = getCombination(_board::RANK[pos]);
-        for (u64 allpieces:combinationsRank) {
-            uchar idx = rankIdx(pos, allpieces);
-            BITBOARD_RANK[pos][idx] = performRankShift(pos, allpieces) | performRankCapture(pos, allpieces);
-        }
-    }
-}
+#ifdef KINDERGARTEN
 
-void Bitboard::popolateAntiDiagonal() {
-    vector <u64> combinationsAntiDiagonal;
-    for (uchar pos = 0; pos < 64; pos++) {
-        combinationsAntiDiagonal = getCombination(_board::ANTIDIAGONAL[pos]);
-        for (u64 allpieces:combinationsAntiDiagonal) {
-            uchar idx = antiDiagonalIdx(pos, allpieces);
-            BITBOARD_ANTIDIAGONAL[pos][idx] =
-                performAntiDiagShift(pos, allpieces) | performAntiDiagCapture(pos, allpieces);
-        }
+void Bitboard::popolateLine(u64 table[64][256], const u64 *line, const bool rook,
+                            uchar (*idx)(const int, const u64)) {
+    for (int pos = 0; pos < 64; pos++) {
+        forEachOccupancy(rook, pos, line[pos], [&](const u64 allpieces, const u64 attacks) {
+            table[pos][idx(pos, allpieces)] = attacks & line[pos];
+        });
     }
 }
 
-u64 Bitboard::performDiagShift(const int position, const u64 allpieces) {
-    u64 q = allpieces & _bitboardTmp::MASK_BIT_UNSET_LEFT_UP[position];
-    u64 k = q ? tmpStruct->MASK_BIT_SET_NOBOUND_TMP[position][BITScanReverse(q)]
-              : _bitboardTmp::MASK_BIT_SET_LEFT_LOWER[position];
-    q = allpieces & _bitboardTmp::MASK_BIT_UNSET_LEFT_DOWN[position];
-    k |= q ? tmpStruct->MASK_BIT_SET_NOBOUND_TMP[position][BITScanForward(q)]
-           : _bitboardTmp::MASK_BIT_SET_LEFT_UPPER[position];
-    return k;
-
-}
-
-u64 Bitboard::performColumnShift(const int position, const u64 allpieces) {
-    u64 q = allpieces & _bitboardTmp::MASK_BIT_UNSET_UP[position];
-    u64 k = q ? tmpStruct->MASK_BIT_SET_NOBOUND_TMP[position][BITScanReverse(q)]
-              : _bitboardTmp::MASK_BIT_SET_VERT_LOWER[position];
-    q = allpieces & _bitboardTmp::MASK_BIT_UNSET_DOWN[position];
-    k |= q ? tmpStruct->MASK_BIT_SET_NOBOUND_TMP[position][BITScanForward(q)]
-           : _bitboardTmp::MASK_BIT_SET_VERT_UPPER[position];
-    return k;
-}
-
-
-u64 Bitboard::performRankShift(const int position, const u64 allpieces) {
-    u64 q = allpieces & _bitboardTmp::MASK_BIT_UNSET_RIGHT[position];
-    u64 k = q ? tmpStruct->MASK_BIT_SET_NOBOUND_TMP[position][BITScanForward(q)]
-              : _bitboardTmp::MASK_BIT_SET_ORIZ_LEFT[position];
-    q = allpieces & _bitboardTmp::MASK_BIT_UNSET_LEFT[position];
-    k |= q ? tmpStruct->MASK_BIT_SET_NOBOUND_TMP[position][BITScanReverse(q)]
-           : _bitboardTmp::MASK_BIT_SET_ORIZ_RIGHT[position];
-    return k;
-}
+#elif defined(HAS_PEXT)
 
-u64 Bitboard::performAntiDiagShift(const int position, const u64 allpieces) {
-    u64 q = allpieces & _bitboardTmp::MASK_BIT_UNSET_RIGHT_UP[position];
-    u64 k = q ? tmpStruct->MASK_BIT_SET_NOBOUND_TMP[position][BITScanReverse(q)]
-              : _bitboardTmp::MASK_BIT_SET_RIGHT_LOWER[position];
-    q = allpieces & _bitboardTmp::MASK_BIT_UNSET_RIGHT_DOWN[position];
-    k |= q ? tmpStruct->MASK_BIT_SET_NOBOUND_TMP[position][BITScanForward(q)]
-           : _bitboardTmp::MASK_BIT_SET_RIGHT_UPPER[position];
-    return k;
-}
-
-u64 Bitboard::performColumnCapture(const int position, const u64 allpieces) {
-    u64 q;
-    u64 k = 0;
-    u64 x = allpieces & FILE_[position];
-    q = x & _bitboardTmp::MASK_BIT_UNSET_UP[position];
-    if (q && allpieces & POW2[BITScanReverse(q)]) {
-        k |= POW2[BITScanReverse(q)];
+void Bitboard::popolateMagic(const bool rook) {
+    _Tmagic *magic = rook ? ROOK_MAGIC : BISHOP_MAGIC;
+    u64 *attacks = rook ? ROOK_ATTACKS : BISHOP_ATTACKS;
+    for (int pos = 0; pos < 64; pos++) {
+        _Tmagic &m = magic[pos];
+        m = getMagic(rook, pos);
+        m.attacks = attacks;
+        forEachOccupancy(rook, pos, m.mask, [&](const u64 allpieces, const u64 a) {
+            attacks[magicIdx(m, allpieces)] = a;
+        });
+        attacks += POW2[bitCount(m.mask)];
     }
-    q = x & _bitboardTmp::MASK_BIT_UNSET_DOWN[position];
-    if (q && allpieces & POW2[BITScanForward(q)]) {
-        k |= POW2[BITScanForward(q)];
-    }
-    return k;
+    _assert(attacks == (rook ? ROOK_ATTACKS + ROOK_ATTACKS_SIZE : BISHOP_ATTACKS + BISHOP_ATTACKS_SIZE));
 }
 
-u64 Bitboard::performRankCapture(const int position, const u64 allpieces) {
-    u64 q;
-    u64 k = 0;
-    u64 x = allpieces & RANK[position];
-    q = x & _bitboardTmp::MASK_BIT_UNSET_LEFT[position];
-    if (q && allpieces & POW2[BITScanReverse(q)]) {
-        k |= POW2[BITScanReverse(q)];
-    }
-    q = x & _bitboardTmp::MASK_BIT_UNSET_RIGHT[position];
-    if (q && allpieces & POW2[BITScanForward(q)]) {
-        k |= POW2[BITScanForward(q)];
-    }
-    return k;
-}
+#endif
 
-u64 Bitboard::performAntiDiagCapture(const int position, const u64 allpieces) {
-    int bound;
-    u64 k = 0;
-    u64 q = allpieces & _bitboardTmp::MASK_BIT_UNSET_RIGHT_UP[position];
-    if (q) {
-        bound = BITScanReverse(q);
-        if (allpieces & POW2[bound]) {
-            k |= POW2[bound];
-        }
+void Bitboard::printMagicTables(const string &fileName) {
+    ofstream out(fileName);
+    if (!out.is_open()) {
+        fatal("error create ", fileName);
+        return;
     }
-    q = allpieces & _bitboardTmp::MASK_BIT_UNSET_RIGHT_DOWN[position];
-    if (q) {
-        bound = BITScanForward(q);
-        if (allpieces & POW2[bound]) {
-            k |= POW2[bound];
+    out << "/*\n"
+        "    Cinnamon UCI chess engine\n"
+        "    Copyright (C) Giuseppe Cannella\n"
+        "\n"
+        "    This program is free software: you can redistribute it and/or modify\n"
+        "    it under the terms of the GNU General Public License as published by\n"
+        "    the Free Software Foundation, either version 3 of the License, or\n"
+        "    (at your option) any later version.\n"
+        "\n"
+        "    This program is distributed in the hope that it will be useful,\n"
+        "    but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+        "    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+        "    GNU General Public License for more details.\n"
+        "\n"
+        "    You should have received a copy of the GNU General Public License\n"
+        "    along with this program.  If not, see <http://www.gnu.org/licenses/>.\n"
+        "*/\n\n"
+        "/// generated by 'cinnamon -bitboard-tables util/BitboardTables.h', included by util/Bitboard.cpp only\n";
+    for (const bool rook:{true, false}) {
+        const char *name = rook ? "ROOK" : "BISHOP";
+        const int size = rook ? ROOK_ATTACKS_SIZE : BISHOP_ATTACKS_SIZE;
+        vector <u64> attacks(size, 0);
+        _Tmagic magic[64];
+        int offset[64];
+        int n = 0;
+        for (int pos = 0; pos < 64; pos++) {
+            _Tmagic &m = magic[pos];
+            m = getMagic(rook, pos);
+            offset[pos] = n;
+            forEachOccupancy(rook, pos, m.mask, [&](const u64 allpieces, const u64 a) {
+                /// always the multiply index, a pext build prints the default build's tables too
+                u64 &entry = attacks[n + (((allpieces & m.mask) * m.magic) >> m.shift)];
+                _assert(!entry || entry == a);
+                entry = a;
+            });
+            n += POW2[bitCount(m.mask)];
         }
-    }
-    return k;
-}
-
-
-u64 Bitboard::performDiagCapture(const int position, const u64 allpieces) {
-    u64 k = 0;
-    int bound;
-    u64 q = allpieces & _bitboardTmp::MASK_BIT_UNSET_LEFT_UP[position];
-    if (q) {
-        bound = BITScanReverse(q);
-        if (allpieces & POW2[bound]) {
-            k |= POW2[bound];
+        _assert(n == size);
+        out << "\nconst u64 Bitboard::" << name << "_ATTACKS[" << name << "_ATTACKS_SIZE] = {";
+        for (int i = 0; i < size; i++) {
+            out << (i ? "," : "") << (i % 4 ? " " : "\n    ") << "0x" << std::hex << std::setw(16) << std::setfill('0')
+                 << attacks[i] << "ULL" << std::dec;
         }
-    }
-    q = allpieces & _bitboardTmp::MASK_BIT_UNSET_LEFT_DOWN[position];
-    if (q) {
-        bound = BITScanForward(q);
-        if (allpieces & POW2[bound]) {
-            k |= POW2[bound];
+        out << "\n};\n\nconst Bitboard::_Tmagic Bitboard::" << name << "_MAGIC[64] = {";
+        for (int pos = 0; pos < 64; pos++) {
+            out << (pos ? "," : "") << "\n    {0x" << std::hex << std::setw(16) << std::setfill('0') << magic[pos].mask
+                 << "ULL, 0x" << std::setw(16) << magic[pos].magic << "ULL, " << std::dec << name << "_ATTACKS + "
+                 << offset[pos] << ", " << magic[pos].shift << "}";
         }
+        out << "\n};\n";
     }
-
-    return k;
-}
-
-vector <u64> Bitboard::combinations(const vector <u64> &elems,
-                                    const int len,
-                                    vector<int> &pos,
-                                    const int depth,
-                                    const int margin) {
-    vector <u64> res;
-    if (depth >= len) {
-        for (unsigned ii = 0; ii < pos.size(); ++ii) {
-            res.push_back(elems[pos[ii]]);
-        }
-        return res;
-    }
-
-    if (((int) elems.size() - margin) < (len - depth))
-        return res;
-
-    for (unsigned ii = margin; ii < elems.size(); ++ii) {
-        pos[depth] = ii;
-        vector <u64> A = combinations(elems, len, pos, depth + 1, ii + 1);
-        res.insert(res.end(), A.begin(), A.end());
-    }
-
-    return res;
 }
-
-vector <u64>  Bitboard::combinations(const vector <u64> &elems, const int len) {
-    vector<int> positions(len, 0);
-    return combinations(elems, len, positions, 0, 0);
-
-}
-
-vector <u64> Bitboard::getCombination(u64 elements) {
-    vector <u64> res;
-    for (; elements; RESET_LSB(elements)) {
-        const int o = BITScanForward(elements);
-        res.push_back(o);
-    }
-    return getCombination(res);
-}
-
-vector <u64> Bitboard::getCombination(const vector <u64> elements) {
-    vector <u64> res;
-    vector <u64> v;
-    u64 bits = 0;
-
-    for (unsigned len = 1; len < elements.size() + 1; len++) {
-        v = combinations(elements, len);
-        unsigned k = 0;
-        for (int rr:v) {
-            bits |= POW2[rr];
-            if (++k == len) {
-                res.push_back(bits);
-                bits = 0;
-                k = 0;
-            }
-        }
-    }
-    return res;
-}
-
-
-
@@ -18,10 +18,17 @@
 
 #pragma once
 
+#include <random>
+#include "SliderFill.h"
+
 static const string EPD2PGN_HELP = "-epd2pgn -f epd_file [-m max_pieces]";
 static const string
     PERFT_HELP = "-perft [-d depth] [-c nCpu] [-h hash size (mb) [-F dump file]] [-f \"fen position\"]";
 static const string DTM_GTB_HELP = "-dtm-gtb -f \"fen position\" -p path [-s scheme] [-i installed pieces]";
+static const string MATE_HELP = "-mate [-d max moves] [-f \"fen position\"] [-b epd file] [-t alpha-beta millsec]";
+static const string BITBOARD_HELP = "-bitboard";
+static const string BITBOARD_TABLES_HELP = "-bitboard-tables util/BitboardTables.h";
+static const string FEN_BENCH_HELP = "-fen-bench [epd_file]";
 static const string PUZZLE_HELP = "-puzzle_epd -t KxyKnm ex: KRKP | KQKP | KBBKN | KQKR | KRKB | KRKN";
 
 class GetOpt {
@@ -34,6 +41,10 @@ private:
         cout << "DTM (gtb):             " << exe << " " << DTM_GTB_HELP << endl;
         cout << "Create .pgn from .epd: " << exe << " " << EPD2PGN_HELP << endl;
         cout << "Generate puzzle epd:   " << exe << " " << PUZZLE_HELP << endl;
+        cout << "Mate search (df-pn):   " << exe << " " << MATE_HELP << endl;
+        cout << "Slider attacks bench:  " << exe << " " << BITBOARD_HELP << endl;
+        cout << "Magic attack tables:   " << exe << " " << BITBOARD_TABLES_HELP << endl;
+        cout << "FEN/EPD throughput:    " << exe << " " << FEN_BENCH_HELP << endl;
     }
 
     static void perft(int argc, char **argv) {
@@ -164,6 +175,260 @@ private:
         searchManager.printDtmGtb();
     }
 
+    /// run a search and return its bestmove, its nodes and whether it announced a mate
+    static tuple<string, u64, bool> alphaBetaMate(IterativeDeeping &it, const string &fen, const int n,
+                                                  const int millsec) {
+        SearchManager &searchManager = Singleton<SearchManager>::getInstance();
+        searchManager.clearHash();
+        searchManager.loadFen(fen);
+        searchManager.setMaxTimeMillsec(millsec);
+        it.setMaxDepth(n * 2);
+        ostringstream out;
+        streambuf *old = cout.rdbuf(out.rdbuf());
+        it.start();
+        it.join();
+        cout.rdbuf(old);
+        const string s = out.str();
+        string bestmove;
+        u64 nodes = 0;
+        size_t pos = s.rfind("bestmove ");
+        if (pos != string::npos) {
+            istringstream(s.substr(pos + 9)) >> bestmove;
+        }
+        pos = s.rfind(" nodes ");
+        if (pos != string::npos) {
+            istringstream(s.substr(pos + 7)) >> nodes;
+        }
+        return make_tuple(bestmove, nodes, s.find("score mate") != string::npos);
+    }
+
+    /// slider attack maps of random boards: per-piece table lookups against the set-wise fills
+    static void bitboardBench() {
+        constexpr int N_BOARDS = 4096;
+        constexpr int N_LOOPS = 2000;
+        Bitboard bitboard;
+        std::mt19937_64 rnd(64);
+        vector<array<u64, 5>> boards(N_BOARDS);
+        for (auto &b:boards) {
+            // two rooks, two bishops and a queen a side on a board about half full
+            b[0] = rnd() & rnd() & rnd();
+            for (int i = 1; i < 5; i++) b[i] = 0;
+            for (int side = 0; side < 2; side++) {
+                for (int i = 0; i < 5; i++) {
+                    const u64 pos = POW2[rnd() & 63];
+                    b[0] |= pos;
+                    if (i != 2) b[1 + side] |= pos;
+                    if (i != 0) b[3 + side] |= pos;
+                }
+            }
+        }
+        u64 check[3] = {0, 0, 0};
+        int millsec[3];
+        for (int type = 0; type < 3; type++) {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int loop = 0; loop < N_LOOPS; loop++) {
+                for (const auto &b:boards) {
+                    u64 attacks[2] = {0, 0};
+                    if (type == 0) {
+                        for (int side = 0; side < 2; side++) {
+                            for (u64 x = b[1 + side]; x; RESET_LSB(x)) {
+                                attacks[side] |= Bitboard::getRankFile(BITScanForward(x), b[0]);
+                            }
+                            for (u64 x = b[3 + side]; x; RESET_LSB(x)) {
+                                attacks[side] |= Bitboard::getDiagonalAntiDiagonal(BITScanForward(x), b[0]);
+                            }
+                        }
+                    } else if (type == 1) {
+                        for (int side = 0; side < 2; side++) {
+                            attacks[side] = SliderFill::getRankFileFill(b[1 + side], b[0]) |
+                                SliderFill::getDiagonalAntiDiagonalFill(b[3 + side], b[0]);
+                        }
+                    } else {
+                        SliderFill::getSliderAttacks(&b[1], &b[3], b[0], attacks);
+                    }
+                    check[type] += attacks[BLACK] ^ (attacks[WHITE] * 3);
+                }
+            }
+            millsec[type] = Time::diffTime(std::chrono::high_resolution_clock::now(), start);
+        }
+        cout << "boards " << N_BOARDS * N_LOOPS << endl;
+        cout << "table lookups   millsec " << millsec[0] << endl;
+        cout << "fill (scalar)   millsec " << millsec[1] << endl;
+#if defined(__AVX2__)
+        cout << "fill (avx2)     millsec " << millsec[2] << endl;
+#elif defined(__SSE2__)
+        cout << "fill (sse2)     millsec " << millsec[2] << endl;
+#else
+        cout << "fill            millsec " << millsec[2] << endl;
+#endif
+        if (check[0] != check[1] || check[0] != check[2]) {
+            cout << "error attacks differ" << endl;
+        }
+    }
+
+    /// df-pn against alpha-beta on "dm N" positions, or solve a single position with -f
+    static void mate(int argc, char **argv) {
+        if (string(optarg) != "ate") {
+            help(argv);
+            return;
+        };
+        int maxMoves = 5;
+        int millsec = 10000;
+        string fen, epdFile;
+        int opt;
+        while ((opt = getopt(argc, argv, "d:f:b:t:")) != -1) {
+            if (opt == 'd') {
+                maxMoves = atoi(optarg);
+            } else if (opt == 'f') {
+                fen = optarg;
+            } else if (opt == 'b') {
+                epdFile = optarg;
+            } else if (opt == 't') {
+                millsec = atoi(optarg);
+            }
+        }
+        MateSearch mateSearch;
+        if (!fen.empty()) {
+            auto start = std::chrono::high_resolution_clock::now();
+            const int n = mateSearch.search(fen, maxMoves);
+            const int t = Time::diffTime(std::chrono::high_resolution_clock::now(), start);
+            if (n) {
+                cout << "mate in " << n << " bestmove " << mateSearch.getBestmove() << " pv " << mateSearch.getPv();
+            } else {
+                cout << "no mate in " << maxMoves;
+            }
+            cout << " nodes " << mateSearch.getNodes() << " millsec " << t << endl;
+            return;
+        }
+        vector<pair<string, int>> positions;
+        if (epdFile.empty()) {
+            positions = {{"6k1/5ppp/8/8/8/8/8/R5K1 w - -", 1},
+                         {"r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5Q2/PPPP1PPP/RNB1K1NR w KQkq -", 1},
+                         {"r2qkb1r/pp2nppp/3p4/2pNN1B1/2BnP3/3P4/PPP2PPP/R2bK2R w KQkq -", 2},
+                         {"6k1/pp4p1/2p5/2bp4/8/P5Pb/1P3rrP/2BRRN1K b - -", 2},
+                         {"r5rk/5p1p/5R2/4B3/8/8/7P/7K w - -", 3},
+                         {"1k5r/pP3ppp/3p2b1/1BN1n3/1Q2P3/P1B5/KP3P1P/7q w - -", 3}};
+        } else {
+            if (!FileUtil::fileExists(epdFile)) {
+                cout << "error file not found  " << epdFile << endl;
+                return;
+            }
+            ifstream inData(epdFile);
+            string line;
+            while (getline(inData, line)) {
+                istringstream uip(line);
+                string token, epdFen;
+                for (int i = 0; i < 4 && uip >> token; i++) {
+                    epdFen += (i ? " " : "") + token;
+                }
+                int dm = maxMoves;
+                while (uip >> token) {
+                    if (token == "dm") {
+                        uip >> dm;
+                        break;
+                    }
+                }
+                if (!epdFen.empty()) {
+                    positions.push_back(make_pair(epdFen, dm));
+                }
+            }
+        }
+        IterativeDeeping it;
+        it.setUseBook(false);
+        int dfpnTime = 0, abTime = 0, dfpnSolved = 0, abSolved = 0;
+        u64 dfpnNodes = 0, abNodes = 0;
+        for (auto &p:positions) {
+            auto start = std::chrono::high_resolution_clock::now();
+            const int n = mateSearch.search(p.first, p.second);
+            const int t1 = Time::diffTime(std::chrono::high_resolution_clock::now(), start);
+            start = std::chrono::high_resolution_clock::now();
+            const auto ab = alphaBetaMate(it, p.first, p.second, millsec);
+            const int t2 = Time::diffTime(std::chrono::high_resolution_clock::now(), start);
+            dfpnTime += t1;
+            abTime += t2;
+            dfpnNodes += mateSearch.getNodes();
+            abNodes += get<1>(ab);
+            dfpnSolved += n != 0;
+            abSolved += get<2>(ab);
+            cout << p.first << " dm " << p.second << endl;
+            cout << "\tdf-pn:      " << (n ? "mate " + to_string(n) : "no mate") << " bestmove "
+                << mateSearch.getBestmove() << " nodes " << mateSearch.getNodes() << " millsec " << t1 << endl;
+            cout << "\talpha-beta: " << (get<2>(ab) ? "mate" : "no mate") << " bestmove " << get<0>(ab)
+                << " nodes " << get<1>(ab) << " millsec " << t2 << endl;
+        }
+        cout << "df-pn      solved " << dfpnSolved << "/" << positions.size() << " nodes " << dfpnNodes
+            << " millsec " << dfpnTime << endl;
+        cout << "alpha-beta solved " << abSolved << "/" << positions.size() << " nodes " << abNodes
+            << " millsec " << abTime << endl;
+    }
+
+    /// FENs per second of the char range parser and of the serializers, on the lines of an epd file or on a few positions
+    static void fenBench(const char *epdFile) {
+        vector<string> fens;
+        if (epdFile) {
+            ifstream inData(epdFile);
+            if (!inData.is_open()) {
+                cout << "error open " << epdFile << endl;
+                return;
+            }
+            string line;
+            while (getline(inData, line)) {
+                if (!line.empty()) fens.push_back(line);
+            }
+        } else {
+            fens = {STARTPOS,
+                    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+                    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+                    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+                    "8/p5p1/k3p1p1/5pP1/5PKP/bP2r3/P7/3RB3 w - f6 bm Rd7; id \"epd\";"};
+        }
+        if (fens.empty()) {
+            return;
+        }
+        const int nLoops = max(1, 2000000 / (int) fens.size());
+        const u64 total = (u64) nLoops * fens.size();
+        ChessBoard chessBoard;
+        _Tchessboard board;
+        char buf[ChessBoard::FEN_MAX_LENGTH];
+        int fifty, errors = 0;
+        u64 check = 0;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int loop = 0; loop < nLoops; loop++) {
+            for (const string &fen:fens) {
+                if (ChessBoard::parseFen(fen.data(), fen.data() + fen.size(), board, fifty) == ChessBoard::FEN_ERROR) {
+                    errors++;
+                }
+                check += board[ZOBRISTKEY_IDX];
+            }
+        }
+        const int parseTime = max(1, Time::diffTime(std::chrono::high_resolution_clock::now(), start));
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int loop = 0; loop < nLoops; loop++) {
+            for (const string &fen:fens) {
+                chessBoard.loadFen(fen.data(), fen.data() + fen.size());
+                check += chessBoard.boardToFen(buf);
+            }
+        }
+        const int bufferTime = max(1, Time::diffTime(std::chrono::high_resolution_clock::now(), start));
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int loop = 0; loop < nLoops; loop++) {
+            for (const string &fen:fens) {
+                chessBoard.loadFen(fen);
+                check += chessBoard.boardToFen().size();
+            }
+        }
+        const int stringTime = max(1, Time::diffTime(std::chrono::high_resolution_clock::now(), start));
+
+        cout << "fens " << total << " errors " << errors / nLoops << " check " << (check & 0xffff) << endl;
+        cout << "parseFen                   FENs/sec " << total * 1000 / parseTime << endl;
+        cout << "loadFen + boardToFen(buf)  FENs/sec " << total * 1000 / bufferTime << endl;
+        cout << "loadFen + boardToFen()     FENs/sec " << total * 1000 / stringTime << endl;
+    }
+
 public:
 
     static void parse(int argc, char **argv) {
@@ -173,14 +438,21 @@ public:
         }
 
         int opt;
-        while ((opt = getopt(argc, argv, "p:e:hd:b:f:")) != -1) {
+        while ((opt = getopt(argc, argv, "p:e:hd:b:f:m:")) != -1) {
             if (opt == 'h') {
                 help(argv);
                 return;
             }
             if (opt == 'f') {  // score
+                if (string(optarg) == "en-bench") {
+                    fenBench(optind < argc ? argv[optind] : nullptr);
+                    return;
+                }
                 SearchManager &searchManager = Singleton<SearchManager>::getInstance();
-                searchManager.loadFen(optarg);
+                if (searchManager.loadFen(optarg) == ChessBoard::FEN_ERROR) {
+                    cout << "bad fen " << optarg << endl;
+                    return;
+                }
                 searchManager.display();
                 searchManager.getScore(searchManager.getSide(), true);
                 return;
@@ -209,6 +481,18 @@ public:
                         return;
                     }
                 } else if (opt == 'b') {
+                    if (string(optarg) == "itboard") {
+                        bitboardBench();
+                        return;
+                    }
+                    if (string(optarg) == "itboard-tables") {
+                        if (optind < argc) {
+                            Bitboard::printMagicTables(argv[optind]);
+                        } else {
+                            help(argv);
+                        }
+                        return;
+                    }
                     int thread = atoi(optarg);
                     unique_ptr <IterativeDeeping> it(new IterativeDeeping());
                     it->setUseBook(false);
@@ -222,6 +506,9 @@ public:
                     }
                     return;
 
+                } else if (opt == 'm') {
+                    mate(argc, argv);
+                    return;
                 } else if (opt == 'd') {
                     if (string(optarg) == "tm-gtb") {
                         dtmGtb(argc, argv);
@@ -0,0 +1,148 @@
+/*
+    Cinnamon UCI chess engine
+    Copyright (C) Giuseppe Cannella
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "../namespaces/def.h"
+#include "../namespaces/board.h"
+
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
+using namespace _def;
+using namespace _board;
+
+/// set-wise slider attack maps (Kogge-Stone occluded fill), the scalar ones also generate the Bitboard tables,
+/// getSliderAttacks is timed against the table lookups by 'cinnamon -bitboard'
+class SliderFill {
+
+public:
+
+    /// union of the attacks of a whole rook (or queen) set, Kogge-Stone occluded fill
+    static inline u64 getRankFileFill(const u64 rooks, const u64 allpieces) {
+        const u64 empty = ~allpieces;
+        return fill(rooks, empty, 1) | fill(rooks, empty, -1) | fill(rooks, empty, 8) | fill(rooks, empty, -8);
+    }
+
+    /// union of the attacks of a whole bishop (or queen) set, Kogge-Stone occluded fill
+    static inline u64 getDiagonalAntiDiagonalFill(const u64 bishops, const u64 allpieces) {
+        const u64 empty = ~allpieces;
+        return fill(bishops, empty, 7) | fill(bishops, empty, -7) | fill(bishops, empty, 9) | fill(bishops, empty, -9);
+    }
+
+    /// attack map of rooks[side] on ranks/files and bishops[side] on diagonals (queens in both sets) for both sides,
+    /// with AVX2 the lanes are black/white rooks and bishops, with SSE2 black/white
+    static inline void getSliderAttacks(const u64 rooks[2], const u64 bishops[2], const u64 allpieces, u64 attacks[2]) {
+#if defined(__AVX2__)
+        const __m256i gen = _mm256_set_epi64x(bishops[WHITE], bishops[BLACK], rooks[WHITE], rooks[BLACK]);
+        const __m256i empty = _mm256_set1_epi64x(~allpieces);
+        const __m256i step1 = _mm256_set_epi64x(9, 9, 1, 1);
+        const __m256i step8 = _mm256_set_epi64x(7, 7, 8, 8);
+        const __m256i notH = _mm256_set1_epi64x(NOT_FILE_H);
+        const __m256i notA = _mm256_set1_epi64x(NOT_FILE_A);
+        const __m256i up8 = _mm256_set_epi64x(NOT_FILE_A, NOT_FILE_A, -1, -1);
+        const __m256i down8 = _mm256_set_epi64x(NOT_FILE_H, NOT_FILE_H, -1, -1);
+        const __m256i res = _mm256_or_si256(
+            _mm256_or_si256(fillAvx2<true>(gen, empty, step1, notH), fillAvx2<false>(gen, empty, step1, notA)),
+            _mm256_or_si256(fillAvx2<true>(gen, empty, step8, up8), fillAvx2<false>(gen, empty, step8, down8)));
+        _mm_storeu_si128((__m128i *) attacks,
+                         _mm_or_si128(_mm256_castsi256_si128(res), _mm256_extracti128_si256(res, 1)));
+#elif defined(__SSE2__)
+        const __m128i r = _mm_loadu_si128((const __m128i *) rooks);
+        const __m128i b = _mm_loadu_si128((const __m128i *) bishops);
+        const __m128i empty = _mm_set1_epi64x(~allpieces);
+        const __m128i res = _mm_or_si128(
+            _mm_or_si128(_mm_or_si128(fillSse2(r, empty, 1), fillSse2(r, empty, -1)),
+                         _mm_or_si128(fillSse2(r, empty, 8), fillSse2(r, empty, -8))),
+            _mm_or_si128(_mm_or_si128(fillSse2(b, empty, 7), fillSse2(b, empty, -7)),
+                         _mm_or_si128(fillSse2(b, empty, 9), fillSse2(b, empty, -9))));
+        _mm_storeu_si128((__m128i *) attacks, res);
+#else
+        attacks[BLACK] = getRankFileFill(rooks[BLACK], allpieces) | getDiagonalAntiDiagonalFill(bishops[BLACK], allpieces);
+        attacks[WHITE] = getRankFileFill(rooks[WHITE], allpieces) | getDiagonalAntiDiagonalFill(bishops[WHITE], allpieces);
+#endif
+    }
+
+private:
+
+    static constexpr u64 NOT_FILE_H = 0xfefefefefefefefeULL;
+    static constexpr u64 NOT_FILE_A = 0x7f7f7f7f7f7f7f7fULL;
+
+    /// squares a step of dir may land on without wrapping round the board (h1 is bit 0, +1 goes towards the a-file)
+    static constexpr u64 fillMask(const int dir) {
+        return (dir == 1 || dir == 9 || dir == -7) ? NOT_FILE_H :
+               (dir == -1 || dir == -9 || dir == 7) ? NOT_FILE_A : 0xffffffffffffffffULL;
+    }
+
+    static constexpr u64 shift(const u64 x, const int dir) {
+        return dir > 0 ? x << dir : x >> -dir;
+    }
+
+    /// slide gen through empty squares in direction dir in three doubling steps, then one more step for the attacks
+    static inline u64 fill(u64 gen, u64 empty, const int dir) {
+        const u64 mask = fillMask(dir);
+        empty &= mask;
+        gen |= empty & shift(gen, dir);
+        empty &= shift(empty, dir);
+        gen |= empty & shift(gen, 2 * dir);
+        empty &= shift(empty, 2 * dir);
+        gen |= empty & shift(gen, 4 * dir);
+        return shift(gen, dir) & mask;
+    }
+
+#if defined(__AVX2__)
+
+    template<bool up>
+    static inline __m256i shiftAvx2(const __m256i x, const __m256i n) {
+        return up ? _mm256_sllv_epi64(x, n) : _mm256_srlv_epi64(x, n);
+    }
+
+    /// fill() with a different step per lane
+    template<bool up>
+    static inline __m256i fillAvx2(__m256i gen, __m256i empty, const __m256i step, const __m256i mask) {
+        const __m256i step2 = _mm256_add_epi64(step, step);
+        empty = _mm256_and_si256(empty, mask);
+        gen = _mm256_or_si256(gen, _mm256_and_si256(empty, shiftAvx2<up>(gen, step)));
+        empty = _mm256_and_si256(empty, shiftAvx2<up>(empty, step));
+        gen = _mm256_or_si256(gen, _mm256_and_si256(empty, shiftAvx2<up>(gen, step2)));
+        empty = _mm256_and_si256(empty, shiftAvx2<up>(empty, step2));
+        gen = _mm256_or_si256(gen, _mm256_and_si256(empty, shiftAvx2<up>(gen, _mm256_add_epi64(step2, step2))));
+        return _mm256_and_si256(shiftAvx2<up>(gen, step), mask);
+    }
+
+#elif defined(__SSE2__)
+
+    static inline __m128i shiftSse2(const __m128i x, const int dir) {
+        return dir > 0 ? _mm_sll_epi64(x, _mm_cvtsi32_si128(dir)) : _mm_srl_epi64(x, _mm_cvtsi32_si128(-dir));
+    }
+
+    /// fill() on both sides at once
+    static inline __m128i fillSse2(__m128i gen, __m128i empty, const int dir) {
+        const __m128i mask = _mm_set1_epi64x(fillMask(dir));
+        empty = _mm_and_si128(empty, mask);
+        gen = _mm_or_si128(gen, _mm_and_si128(empty, shiftSse2(gen, dir)));
+        empty = _mm_and_si128(empty, shiftSse2(empty, dir));
+        gen = _mm_or_si128(gen, _mm_and_si128(empty, shiftSse2(gen, 2 * dir)));
+        empty = _mm_and_si128(empty, shiftSse2(empty, 2 * dir));
+        gen = _mm_or_si128(gen, _mm_and_si128(empty, shiftSse2(gen, 4 * dir)));
+        return _mm_and_si128(shiftSse2(gen, dir), mask);
+    }
+
+#endif
+};
@@ -0,0 +1,81 @@
+/*
+    Cinnamon UCI chess engine
+    Copyright (C) Giuseppe Cannella
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// lookups of a constant table at one call site, TABLE(t) in a -DBENCH_MODE build
+class TableStats {
+
+public:
+
+    TableStats(const char *name, const size_t size) : name(name), size(size) {
+        std::lock_guard <std::mutex> lock(getMutex());
+        getSites().push_back(this);
+    }
+
+    inline void hit() {
+        hits++;
+    }
+
+    /// size and lookups of each table summed over its call sites, most used first
+    static void printAndReset() {
+        std::lock_guard <std::mutex> lock(getMutex());
+        /// name -> bytes, lookups
+        map<string, pair<size_t, unsigned long long>> tables;
+        for (TableStats *site:getSites()) {
+            auto &t = tables[site->name];
+            t.first = site->size;
+            t.second += site->hits;
+            site->hits = 0;
+        }
+        typedef pair<string, pair<size_t, unsigned long long>> _Ttable;
+        vector<_Ttable> sorted(tables.begin(), tables.end());
+        std::sort(sorted.begin(), sorted.end(), [](const _Ttable &a, const _Ttable &b) {
+            return a.second.second > b.second.second;
+        });
+        for (const auto &t:sorted) {
+            cout << "info string table " << left << setw(24) << t.first << right << setw(8) << t.second.first
+                 << " bytes " << setw(14) << t.second.second << " lookups" << endl;
+        }
+    }
+
+private:
+    const char *name;
+    const size_t size;
+    unsigned long long hits = 0;
+
+    static vector<TableStats *> &getSites() {
+        static vector<TableStats *> sites;
+        return sites;
+    }
+
+    static mutex &getMutex() {
+        static mutex m;
+        return m;
+    }
+};